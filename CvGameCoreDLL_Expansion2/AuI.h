@@ -35,6 +35,8 @@
 #define AUI_BINOM_RNG
 /// Minor Civ tracking (especially useful for cases with no minor civs or lots of minor civs relative to major civs)
 #define AUI_MINOR_CIV_RATIO
+/// CvGame keeps per-player-pair aggregates (city pair count, total distance, minimum distance) of the distances between players' cities, updated whenever a city is founded, captured, or destroyed
+#define AUI_GAME_CITY_DISTANCE_MATRIX
 /// Turns the "Has met Major Civ" check inside GS priority checks into a public function of CvGrandStrategyAI
 #define AUI_PUBLIC_HAS_MET_MAJOR
 /// Implements a new function that flips a unit's UnitAIType to a certain allowed value or off of a certain value
@@ -63,6 +65,10 @@
 #define AUI_FIX_HEX_DISTANCE_INSTEAD_OF_PLOT_DISTANCE
 /// Implements the missing erase(iterator) function for FFastVector
 #define AUI_FIX_FFASTVECTOR_ERASE
+/// Saves write the hash of every info type once per category and section (map, player, team), then store info-indexed arrays and types as dense indices that are remapped on load through a flat translation vector
+#define AUI_SERIALIZATION_TYPE_DICTIONARY
+/// When prefetching a table of infos, each child table read through CvDatabaseUtility's PopulateArrayBy...() functions is queried once and grouped by parent in memory instead of being queried once per parent row, and MaxRows() results are cached
+#define AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 
 #ifdef AUI_FAST_COMP
 // Avoids Visual Studio's compiler from generating inefficient code
@@ -90,6 +96,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_ASTAR_FIX_CONSIDER_DANGER_USES_COMBAT_STRENGTH (6)
 /// AI-controlled units no longer ignore all paths with peaks; since the peak plots are check anyway for whether or not a unit can enter them, this check is pointless 
 #define AUI_ASTAR_FIX_PATH_VALID_PATH_PEAKS_FOR_NONHUMAN
+/// The node cache of PathValid() and TacticalAnalysisMapPathValid() only calls the expensive canEnterTerrain() for mountain plots, since the cached result is only ever read for mountains
+#define AUI_ASTAR_CAN_ENTER_TERRAIN_ONLY_FOR_MOUNTAINS
 
 // AI Operations Stuff
 /// If a settler tries and fails the no escort check, keep rerolling each turn
@@ -172,12 +180,20 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_WORKER_FIX_SHOULD_CONSIDER_PLOT_WORK_BOATS_CONSIDER_ALL_SEA_PLOTS
 /// Only disregard an impassable plot if the unit cannot enter impassable plots
 #define AUI_WORKER_FIX_SHOULD_CONSIDER_PLOT_FLYING_WORKER_DISREGARDS_PEAKS
+/// Projected yield scores of plot-build pairs do not depend on the worker, so they are computed once per turn for all workers of a player (a plot's scores are dropped if its improvement, feature, route, resource, owner or working city changes)
+#define AUI_WORKER_SHARED_BUILD_SCORES
+#ifdef AUI_WORKER_FIND_TURNS_AWAY_USES_PATHFINDER
+/// EvaluateBuilder() queries the turns away of all candidate plots in order of increasing distance from the worker, so the reused pathfinder search grows outward as a single search instead of being restarted or re-expanded for each plot
+#define AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+#endif // AUI_WORKER_FIND_TURNS_AWAY_USES_PATHFINDER
 
 // City Stuff
 /// Shifts the scout assignment code to EconomicAI
 #define AUI_CITY_FIX_CREATE_UNIT_EXPLORE_ASSIGNMENT_TO_ECONOMIC
 /// Reenables the purchasing of buildings with gold (originally from Ninakoru's Smart AI, but heavily modified since)
 #define AUI_CITY_FIX_BUILDING_PURCHASES_WITH_GOLD
+/// canConstruct() only walks the building classes a building actually needs or locks and the buildings in its mutually exclusive group instead of every building (class)
+#define AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 
 // City Citizens Stuff
 /// Unhardcodes the value assigned to specialists for great person points (flat value is the base multiplier for value of a single GP point before modifications)
@@ -206,6 +222,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 //#define AUI_CITYSTRATEGY_CHOOSE_PRODUCTION_NORMALIZE_LIST
 /// If the player has yet to unlock an ideology, multiply the base weight of buildings that can unlock ideologies by this value
 #define AUI_CITYSTRATEGY_EMPHASIZE_FACTORIES_IF_NO_IDEOLOGY (8)
+/// Flavor updates hand the full flavor vector to the production AIs, which then make a single pass over their entries (dot product of each entry's flavor row with the vector) instead of one pass per flavor
+#define AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
 
 // Culture Classes Stuff
 /// AI only wants propaganda diplomats with players of different ideologies (since that's the only time they get the tourism bonus)
@@ -216,6 +234,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_PLAYERCULTURE_WANTS_DIPLOMAT_DOING_PROPAGANDA_INFLUENCE_TURNS_USED
 /// The AI will only want propaganda spies if its tourism is greater than a certain amount (will actually use Science Boost amount if it's active)
 #define AUI_PLAYERCULTURE_GET_MAX_PROPAGANDA_DIPLOMATS_WANTED_FILTER_TOURISM (8)
+/// Player-to-player tourism modifier components are cached in a game-wide matrix that is rebuilt once per turn or whenever a relevant event (open borders, trade routes, wars, policies, spies, religion) dirties it
+#define AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 // Danger Plots Stuff
 /// Better danger calculation for ranged units (originally from Ninakoru's Smart AI, but heavily modified since)
@@ -233,9 +253,21 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 /// Counts air unit strength into danger (commented out for now)
 //#define AUI_DANGER_PLOTS_COUNT_AIR_UNITS
 
+// Barbarians Stuff
+#ifdef AUI_HEXSPACE_DX_LOOPS
+/// When new barbarian camps are to be placed, valid plots are gathered into a candidate list (coastal plots first) and exclusion zones around capitals, camps, and recently cleared camps are stamped once, so random draws sample the list directly instead of rolling over every plot on the map and scanning hex discs around each roll
+#define AUI_BARBARIANS_CAMP_CANDIDATE_SET
+#endif // AUI_HEXSPACE_DX_LOOPS
+
+// DealAI Stuff
+/// While a deal is being equalized, trade item values are memoized by item type, data, and direction, so the equalization passes and the deal rescoring after every added item stop revaluing the same items over and over
+#define AUI_DEALAI_ITEM_VALUE_MEMO
+
 // DiplomacyAI Stuff
 /// If the first adjusted value is out of bounds, keep rerolling with the amount with which it is out of bounds until we remain in bounds
 #define AUI_DIPLOMACY_GET_RANDOM_PERSONALITY_WEIGHT_USE_REROLLS
+/// Facts that DoTurn's evaluation passes keep requerying for every player pair (who knows whom, team war counts, city defensive strengths) are gathered once at the start of DoTurn and read from tables by all passes
+#define AUI_DIPLOMACY_TURN_FACTS
 #ifdef AUI_BINOM_RNG
 /// When modifying a personality value (eg. Boldness, Wonder Competitiveness), the AI will use the binomial RNG for a normal distribution instead of a flat one
 #define AUI_DIPLOMACY_GET_RANDOM_PERSONALITY_WEIGHT_USES_BINOM_RNG
@@ -293,6 +325,10 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 /// Player settlers captured by barbarians still add to the player's settler count
 #define AUI_ECONOMIC_EARLY_EXPANSION_CAPTURED_BARBARIAN_SETTLERS_COUNT
 
+// Espionage Stuff
+/// A spy's tech stealing rate is derived from the city's already computed base potential instead of evaluating the city again, and offensive target scoring evaluates each target civ once instead of once per city
+#define AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+
 // Flavor Manager Stuff
 /// Players that start as human no longer load in default flavor values
 #define AUI_FLAVOR_MANAGER_HUMANS_GET_FLAVOR
@@ -400,6 +436,18 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_HOMELAND_PLOT_WORKER_SEA_MOVES_DISBAND_WORK_BOATS_WITHOUT_TARGET
 /// If the AI wants to use a unit for a Great Work, check if the unit can create one right there and then (performance improvement)
 #define AUI_HOMELAND_EXECUTE_GP_MOVE_INSTANT_GREAT_WORK_CHECK
+/// When picking the best unit for a target, land units that are confined to their landmass (no embarking, hovering, all-terrain movement, or paradropping) are dropped without a pathfinder call if the target lies in another area, so they neither waste A* runs nor count towards the failed path early-out
+#define AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+/// Turns-to-target results used when picking units for homeland moves are memoized per target plot for the rest of the homeland update; the memo is dropped as soon as any unit changes plots, an entry only applies while its unit has the same moves left, and it is shared with units of the same type, promotions, and embark state standing on that plot
+#define AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+
+// Map Stuff
+/// Keeps per-player grids of combat unit power and great general presence (with per-row prefix sums) plus a list of air units, updated incrementally as units move, take damage, or level up; used for "power within range of a plot" queries instead of scanning every unit
+#define AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+/// CvMap saves plot types, ownership, revealed state, and per-team/per-player plot arrays as contiguous columns across all plots (one WriteIt per column, run-length encoded when sparse) instead of field by field inside every CvPlot::write()
+#define AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+#endif
 
 // Military AI Stuff
 /// VITAL FOR MOST FUNCTIONS! Use double instead of int for certain variables (to retain information during division)
@@ -462,6 +510,14 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_PLAYER_GET_BEST_SETTLE_PLOT_USE_MINIMUM_FERTILITY
 /// Minor code modifications that are minor optimizations and help with debugging
 #define AUI_PLAYER_GET_BEST_SETTLE_PLOT_DEBUG_HELP
+/// Players keep running counts of owned buildings with certain flags (eg. buildings that nullify the influence modifier), so checking for them no longer loops through every city and building class
+#define AUI_PLAYER_BUILDING_FLAG_COUNTS
+/// Players keep a running total of their units' military might that units update whenever they are created, killed, damaged, healed, or level up, so reading military might no longer loops through every unit and is never a turn out of date (economic might remains cached once per turn)
+#define AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+/// The dataset indices of the built-in replay statistics are looked up by name once per player instead of 27 string searches per turn, city yields for the replay are gathered in one pass over the cities, and replay histories are handed out by reference instead of copying the whole turn map
+#define AUI_PLAYER_INTERNED_REPLAY_DATASETS
+/// Adds batched versions of calculateTotalYield() that sum several yields over a player's cities in one pass (production is only computed once per city, even if processes convert it into other yields)
+#define AUI_PLAYER_BATCHED_TOTAL_YIELDS
 
 // PlayerAI Stuff
 /// Great prophet will be chosen as a free great person if the AI can still found a religion with them
@@ -504,8 +560,18 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_PLAYERAI_FIND_BEST_MERCHANT_TARGET_PLOT_VENICE_FILTERS
 /// When updating the settle value of a landmass with a new plot, MAX() is used instead of addition
 #define AUI_PLAYERAI_FIX_UPDATE_FOUND_VALUES_NOT_ADDITIVE
+/// Found values are only recomputed for plots whose surroundings changed (ownership, reveal, terrain, feature, resource, improvement, route, river, cities) since the player's last update; value is the radius around a changed plot that gets dirtied (should match the scan radius of PlotFoundValue())
+#define AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES (7)
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+/// Every this many turns all found values are recomputed anyway, to catch inputs that neither plot dirtying nor the player checksum cover (eg. city counts of other areas, area changes)
+#define AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES_FULL_REFRESH_INTERVAL (10)
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 
 // Plot Stuff
+/// Each plot keeps a per-player count of that player's cities close enough for the plot to be on their home front, updated when cities are placed or removed, so IsHomeFrontForPlayer() no longer loops over all of the player's cities
+#define AUI_PLOT_HOME_FRONT_COUNTS
+/// Each plot remembers the owner of its units when they all belong to the same player (refreshed from the IDInfo list whenever a unit is added or removed), so enemy unit and defender queries can bail out without resolving a single unit when everything on the plot belongs to the asking team
+#define AUI_PLOT_UNITS_SOLE_OWNER
 /// If a plot is unowned, CalculateNatureYield() will assume the plot is owned by a future player
 #define AUI_PLOT_CALCULATE_NATURE_YIELD_USE_POTENTIAL_FUTURE_OWNER_IF_UNOWNED
 #ifdef AUI_PLOT_CALCULATE_NATURE_YIELD_USE_POTENTIAL_FUTURE_OWNER_IF_UNOWNED
@@ -548,6 +614,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_POLICY_DO_CONSIDER_IDEOLOGY_SWITCH_TWEAKED_CLEAR_PREFS
 /// Gets all possible happiness sources the branch can give, not just building-based ones (eg. specialists, trade routes, luxuries, etc.)
 #define AUI_POLICY_GET_BRANCH_BUILDING_HAPPINESS_GET_ALL_HAPPINESS_SOURCES
+/// Prerequisite weight propagation walks a flattened per-policy table of (prereq, depth, path count) terms built once from the policy tree instead of recursing through the tree for every weighted policy
+#define AUI_POLICY_PREREQ_WEIGHT_CLOSURE
 
 // Religion/Belief Stuff
 /// VITAL FOR MOST FUNCTIONS! Use double instead of int for certain variables (to retain information during division)
@@ -898,10 +966,14 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #endif
 /// Buildings that contribute towards getting an ideology act as a unique building for the purposes of tech scoring
 #define AUI_PLAYERTECHS_RESET_IDEOLOGY_UNLOCKERS_COUNT_AS_UNIQUE
+/// Team techs keep an array of which techs have all of their OR and AND prerequisites met, rebuilt whenever the team gains or loses a tech, so CanResearch() (when not checking trade restrictions) no longer walks the prerequisite lists every call
+#define AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 // Tech AI Stuff
 /// The AI wants an expensive tech if it's selecting a free tech
 #define AUI_TECHAI_CHOOSE_NEXT_TECH_FREE_TECH_WANTS_EXPENSIVE
+/// Prerequisite weight propagation walks a flattened per-tech table of (prereq, depth, path count) terms built once from the tech tree instead of recursing through the tree for every weighted tech
+#define AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
 
 // Trade Stuff
 /// Adds a minimum danger amount for each plot, to discourage long routes
@@ -934,6 +1006,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 // Unit Stuff
 /// Adds a function to return a unit's movement range if it can attack after a move + the unit's range (originally from Ninakoru's Smart AI)
 #define AUI_UNIT_RANGE_PLUS_MOVE
+/// Memoizes the plot scans behind a unit's surroundings-based combat modifiers (great generals, reverse great generals, nearby improvements, adjacent friendly units); memos are invalidated by a global counter bumped when units move or change promotions, war or peace is declared, improvements or policies change, and at the start of each turn
+#define AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 /// Fixes the check for whether ranged damage would be more than heal rate to use >= instead of >, adds a flat value to total damage at start (both make up for randomness), and treats cities as an expected damage source instead of a flat "yes"
 #define AUI_UNIT_FIX_UNDER_ENEMY_RANGED_ATTACK_HEALRATE (1)
 /// Adds a function to return whether a unit can range strike at a target from a plot (originally from Ninakoru's Smart AI)
@@ -994,6 +1068,10 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_VOTING_TWEAKED_WORLD_RELIGION
 /// Uses a different algorithm and unifies the code for scoring voting on arts funding and sciences funding
 #define AUI_VOTING_TWEAKED_ARTS_SCIENCES_FUNDING
+#if defined(AUI_VOTING_USE_DOUBLES) && defined(AUI_GS_PRIORITY_RATIO) && defined(AUI_VOTING_TWEAKED_INTERNATIONAL_PROJECTS) && defined(AUI_VOTING_TWEAKED_EMBARGO_MINOR_CIVS) && defined(AUI_VOTING_TWEAKED_BAN_LUXURY) && defined(AUI_VOTING_TWEAKED_ARTS_SCIENCES_FUNDING)
+/// While the AI allocates its proposals or votes, player-wide inputs to proposal scoring (victory ratios, production might, trade and happiness summaries, relations with each civ, etc.) are gathered once and shared by every candidate instead of being recomputed per proposal and choice
+#define AUI_VOTING_EVALUATION_CONTEXT
+#endif
 
 // Wonder Production AI Stuff
 /// Does a flavor update each time a wonder is to be chosen (helps when multiple wonders are to be chosen in a single turn)
@@ -1004,6 +1082,8 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AUI_WONDER_PRODUCTION_CHOOSE_WONDER_FOR_GREAT_ENGINEER_WEIGH_COST
 /// Divides base weight by this number for all non-world wonders
 #define AUI_WONDER_PRODUCITON_CHOOSE_WONDER_FOR_GREAT_ENGINEER_WANT_WORLD_WONDER (10)
+/// Flavor updates make a single pass over the buildings with the full flavor vector instead of one pass per flavor
+#define AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
 
 // GlobalDefines (GD) wrappers
 // INT
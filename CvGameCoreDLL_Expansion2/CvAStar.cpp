@@ -1226,7 +1226,11 @@ int PathValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* poin
 	kToNodeCacheData.iNumFriendlyUnitsOfType = pToPlot->getNumFriendlyUnitsOfType(pUnit);
 	kToNodeCacheData.bIsMountain = pToPlot->isMountain();
 	kToNodeCacheData.bIsWater = (pToPlot->isWater() && !pToPlot->IsAllowsWalkWater());
+#ifdef AUI_ASTAR_CAN_ENTER_TERRAIN_ONLY_FOR_MOUNTAINS
+	kToNodeCacheData.bCanEnterTerrain = !kToNodeCacheData.bIsMountain || pUnit->canEnterTerrain(*pToPlot, CvUnit::MOVEFLAG_PRETEND_CORRECT_EMBARK_STATE);
+#else
 	kToNodeCacheData.bCanEnterTerrain = pUnit->canEnterTerrain(*pToPlot, CvUnit::MOVEFLAG_PRETEND_CORRECT_EMBARK_STATE);
+#endif // AUI_ASTAR_CAN_ENTER_TERRAIN_ONLY_FOR_MOUNTAINS
 	kToNodeCacheData.bIsRevealedToTeam = pToPlot->isRevealed(eUnitTeam);
 	kToNodeCacheData.bContainsOtherFriendlyTeamCity = false;
 	CvCity* pCity = pToPlot->getPlotCity();
@@ -3392,7 +3396,11 @@ int TacticalAnalysisMapPathValid(CvAStarNode* parent, CvAStarNode* node, int dat
 	kToNodeCacheData.iNumFriendlyUnitsOfType = pToPlot->getNumFriendlyUnitsOfType(pUnit);
 	kToNodeCacheData.bIsMountain = pToPlot->isMountain();
 	kToNodeCacheData.bIsWater = pToPlotCell->IsWater();
+#ifdef AUI_ASTAR_CAN_ENTER_TERRAIN_ONLY_FOR_MOUNTAINS
+	kToNodeCacheData.bCanEnterTerrain = !kToNodeCacheData.bIsMountain || pUnit->canEnterTerrain(*pToPlot, CvUnit::MOVEFLAG_PRETEND_CORRECT_EMBARK_STATE);
+#else
 	kToNodeCacheData.bCanEnterTerrain = pUnit->canEnterTerrain(*pToPlot, CvUnit::MOVEFLAG_PRETEND_CORRECT_EMBARK_STATE);
+#endif // AUI_ASTAR_CAN_ENTER_TERRAIN_ONLY_FOR_MOUNTAINS
 	kToNodeCacheData.bIsRevealedToTeam = pToPlotCell->IsRevealed();
 	kToNodeCacheData.bContainsOtherFriendlyTeamCity = false;
 	if(pToPlotCell->IsCity())
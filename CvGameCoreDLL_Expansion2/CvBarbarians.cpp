@@ -67,6 +67,33 @@ bool CvBarbarians::IsPlotValidForBarbCamp(CvPlot* pPlot)
 	return true;
 }
 
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+//	--------------------------------------------------------------------------------
+/// Flags every plot within iRange of pPlot as unable to host a new camp
+void CvBarbarians::MarkBarbCampExclusionZone(const CvPlot* pPlot, int iRange, std::vector<bool>& abExcluded)
+{
+	int iDX, iDY, iMaxDX;
+	CvPlot* pLoopPlot;
+	for (iDY = -iRange; iDY <= iRange; iDY++)
+	{
+#ifdef AUI_FAST_COMP
+		iMaxDX = iRange - FASTMAX(0, iDY);
+		for (iDX = -iRange - FASTMIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#else
+		iMaxDX = iRange - MAX(0, iDY);
+		for (iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#endif // AUI_FAST_COMP
+		{
+			pLoopPlot = plotXY(pPlot->getX(), pPlot->getY(), iDX, iDY);
+			if (pLoopPlot)
+			{
+				abExcluded[pLoopPlot->GetPlotIndex()] = true;
+			}
+		}
+	}
+}
+#endif // AUI_BARBARIANS_CAMP_CANDIDATE_SET
+
 //	--------------------------------------------------------------------------------
 /// Camp cleared, so reset counter
 void CvBarbarians::DoBarbCampCleared(CvPlot* pPlot, PlayerTypes ePlayer)
@@ -358,6 +385,152 @@ void CvBarbarians::DoCamps()
 			int iPlayerCapitalMinDistance = /*4*/ GC.getBARBARIAN_CAMP_MINIMUM_DISTANCE_CAPITAL();
 			int iBarbCampMinDistance = /*7*/ GC.getBARBARIAN_CAMP_MINIMUM_DISTANCE_ANOTHER_CAMP();
 			int iMaxDistanceToLook = iPlayerCapitalMinDistance > iBarbCampMinDistance ? iPlayerCapitalMinDistance : iBarbCampMinDistance;
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+			// Nothing to place (eg. the spawn roll failed), so skip building the candidate set; the coastal bias roll above still happens to keep the RNG sequence unchanged
+			if (iNumCampsToAdd > 0)
+			{
+				int iPlayerLoop;
+
+				// Stamp out every plot that is too close to a major's capital, an existing camp, or a recently cleared camp
+				std::vector<bool> abExcluded(iNumPlots, false);
+				for (iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+				{
+					CvPlayer& kLoopPlayer = GET_PLAYER((PlayerTypes)iPlayerLoop);
+					if (kLoopPlayer.isAlive() && kLoopPlayer.getCapitalCity())
+					{
+						MarkBarbCampExclusionZone(kLoopPlayer.getCapitalCity()->plot(), iPlayerCapitalMinDistance, abExcluded);
+					}
+				}
+				for (iPlotIndex = 0; iPlotIndex < iNumPlots; iPlotIndex++)
+				{
+					pLoopPlot = kMap.plotByIndexUnchecked(iPlotIndex);
+					if (pLoopPlot->getImprovementType() == eCamp)
+					{
+						MarkBarbCampExclusionZone(pLoopPlot, iBarbCampMinDistance, abExcluded);
+					}
+					// If the counter is below -1 that means a camp was cleared recently
+					if (m_aiPlotBarbCampSpawnCounter[iPlotIndex] < -1)
+					{
+						MarkBarbCampExclusionZone(pLoopPlot, 4, abExcluded);
+					}
+				}
+
+				// Gather plots that pass every check that cannot change while camps are being placed; coastal plots are kept at the front
+				std::vector<int> aiCandidates;
+				aiCandidates.reserve(iNumLandPlots);
+				int iNumCoastalCandidates = 0;
+				for (iPlotIndex = 0; iPlotIndex < iNumPlots; iPlotIndex++)
+				{
+					if (abExcluded[iPlotIndex])
+						continue;
+
+					pLoopPlot = kMap.plotByIndexUnchecked(iPlotIndex);
+					if (pLoopPlot->isWater() || pLoopPlot->isImpassable() || pLoopPlot->isMountain())
+						continue;
+					if (pLoopPlot->isOwned() || pLoopPlot->isVisibleToCivTeam())
+						continue;
+					// JON: NO RESOURCES FOR NOW, MAY REPLACE WITH SOMETHING COOLER
+					if (pLoopPlot->getResourceType() != NO_RESOURCE)
+						continue;
+					// No camps on 1-tile islands
+					if (kMap.getArea(pLoopPlot->getArea())->getNumTiles() <= 1)
+						continue;
+					// Don't look at Tiles that already have an improvement or can't have one
+					if (pLoopPlot->getImprovementType() != NO_IMPROVEMENT)
+						continue;
+					if (pLoopPlot->getFeatureType() != NO_FEATURE && GC.getFeatureInfo(pLoopPlot->getFeatureType())->isNoImprovement())
+						continue;
+
+					aiCandidates.push_back(iPlotIndex);
+					if (pLoopPlot->isCoastalLand())
+					{
+						aiCandidates.back() = aiCandidates[iNumCoastalCandidates];
+						aiCandidates[iNumCoastalCandidates] = iPlotIndex;
+						iNumCoastalCandidates++;
+					}
+				}
+
+				int iNumCandidates = (int)aiCandidates.size();
+				int iCandidate;
+				PlayerTypes ePlayer;
+				TeamTypes eTeam;
+
+				// Find Plots to put the Camps
+				while (iNumCampsToAdd > 0)
+				{
+					if (bWantsCoastal)
+					{
+						if (iNumCoastalCandidates <= 0)
+							break;
+						iCandidate = kGame.getJonRandNum(iNumCoastalCandidates, "Barb Camp Plot-Finding Roll");
+					}
+					else
+					{
+						if (iNumCandidates <= 0)
+							break;
+						iCandidate = kGame.getJonRandNum(iNumCandidates, "Barb Camp Plot-Finding Roll");
+					}
+
+					iPlotIndex = aiCandidates[iCandidate];
+					pLoopPlot = kMap.plotByIndexUnchecked(iPlotIndex);
+
+					// Remove the candidate from the list while keeping coastal plots at the front
+					if (iCandidate < iNumCoastalCandidates)
+					{
+						iNumCoastalCandidates--;
+						aiCandidates[iCandidate] = aiCandidates[iNumCoastalCandidates];
+						aiCandidates[iNumCoastalCandidates] = aiCandidates[iNumCandidates - 1];
+					}
+					else
+					{
+						aiCandidates[iCandidate] = aiCandidates[iNumCandidates - 1];
+					}
+					iNumCandidates--;
+
+					// Camps placed earlier in this loop may have excluded this plot
+					if (abExcluded[iPlotIndex])
+						continue;
+
+					// Max Camps for this area, add 1 just in case the algorithm rounded something off; area camp counts only go up here, so a full area stays full
+					iMaxCampsThisArea = iCampTargetNum * pLoopPlot->area()->getNumTiles() / iNumLandPlots + 1;
+					if (pLoopPlot->area()->getNumImprovements(eCamp) > iMaxCampsThisArea)
+						continue;
+
+					pLoopPlot->setImprovementType(eCamp);
+					DoCampActivationNotice(pLoopPlot);
+					MarkBarbCampExclusionZone(pLoopPlot, iBarbCampMinDistance, abExcluded);
+
+					eBestUnit = GetRandomBarbarianUnitType(kMap.getArea(pLoopPlot->getArea()), UNITAI_DEFENSE);
+
+					if (eBestUnit != NO_UNIT)
+					{
+						GET_PLAYER(BARBARIAN_PLAYER).initUnit(eBestUnit, pLoopPlot->getX(), pLoopPlot->getY(), (UnitAITypes) GC.getUnitInfo(eBestUnit)->GetDefaultUnitAIType());
+					}
+
+					// If we should update Camp visibility (for Policy), do so
+					for (iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+					{
+						ePlayer = (PlayerTypes) iPlayerLoop;
+						eTeam = GET_PLAYER(ePlayer).getTeam();
+
+						if (GET_PLAYER(ePlayer).IsAlwaysSeeBarbCamps())
+						{
+							if (pLoopPlot->isRevealed(eTeam))
+							{
+								pLoopPlot->setRevealedImprovementType(eTeam, eCamp);
+								if (GC.getGame().getActivePlayer() == ePlayer)
+									bAlwaysRevealedBarbCamp = true;
+							}
+						}
+					}
+
+					iNumCampsToAdd--;
+
+					// Seed the next Camp for Coast or not
+					bWantsCoastal = kGame.getJonRandNum(/*5*/ GC.getBARBARIAN_CAMP_COASTAL_SPAWN_ROLL(), "Barb Camp Plot-Finding Roll - Coastal Bias 2") == 0 ? true : false;
+				}
+			}
+#else
 			int iPlotDistance;
 
 			int iDX, iDY;
@@ -521,6 +694,7 @@ void CvBarbarians::DoCamps()
 				}
 			}
 			while(iNumCampsToAdd > 0 && iCount < iNumLandPlots);
+#endif // AUI_BARBARIANS_CAMP_CANDIDATE_SET
 		}
 	}
 
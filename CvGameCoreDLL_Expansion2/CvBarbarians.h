@@ -35,6 +35,9 @@ private:
 	static bool IsPlotValidForBarbCamp(CvPlot* pPlot);
 	static UnitTypes GetRandomBarbarianUnitType(CvArea* pArea, UnitAITypes eUnitAI);
 	static void DoCampActivationNotice(CvPlot* pPlot);
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+	static void MarkBarbCampExclusionZone(const CvPlot* pPlot, int iRange, std::vector<bool>& abExcluded);
+#endif // AUI_BARBARIANS_CAMP_CANDIDATE_SET
 
 	static short* m_aiPlotBarbCampSpawnCounter;
 	static short* m_aiPlotBarbCampNumUnitsSpawned;
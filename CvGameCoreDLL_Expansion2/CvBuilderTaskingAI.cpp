@@ -51,6 +51,12 @@ void CvBuilderTaskingAI::Init(CvPlayer* pPlayer)
 	m_bLogging = GC.getLogging() && GC.getAILogging() && GC.GetBuilderAILogging();
 	m_iNumCities = -1;
 	m_pTargetPlot = NULL;
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+	m_iBuildScoreCacheTurn = -1;
+	m_aiBuildScoreSlot.clear();
+	m_aiBuildScoreSlotSignature.clear();
+	m_aiBuildScores.clear();
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 
 	// special case code so the Dutch don't remove marshes
 	m_bKeepMarshes = false;
@@ -104,6 +110,12 @@ void CvBuilderTaskingAI::Uninit(void)
 	m_bLogging = false;
 	m_iNumCities = -1;
 	m_pTargetPlot = NULL;
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+	m_iBuildScoreCacheTurn = -1;
+	m_aiBuildScoreSlot.clear();
+	m_aiBuildScoreSlotSignature.clear();
+	m_aiBuildScores.clear();
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 }
 
 /// Serialization read
@@ -733,6 +745,11 @@ bool CvBuilderTaskingAI::EvaluateBuilder(CvUnit* pUnit, BuilderDirective* paDire
 		m_aiPlots = m_pPlayer->GetPlots();
 	}
 
+#ifdef AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+	std::vector<int> aiTurnsAway;
+	FindTurnsAwayNearestFirst(pUnit, aiTurnsAway);
+#endif // AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+
 	// go through all the plots the player has under their control
 	for(uint uiPlotIndex = 0; uiPlotIndex < m_aiPlots.size(); uiPlotIndex++)
 	{
@@ -749,6 +766,14 @@ bool CvBuilderTaskingAI::EvaluateBuilder(CvUnit* pUnit, BuilderDirective* paDire
 
 		CvPlot* pPlot = GC.getMap().plotByIndex(m_aiPlots[uiPlotIndex]);
 
+#ifdef AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+		// -2 means the plot was not considered
+		int iMoveTurnsAway = aiTurnsAway[uiPlotIndex];
+		if(iMoveTurnsAway == -2)
+		{
+			continue;
+		}
+#else
 		if(!ShouldBuilderConsiderPlot(pUnit, pPlot))
 		{
 			continue;
@@ -757,6 +782,7 @@ bool CvBuilderTaskingAI::EvaluateBuilder(CvUnit* pUnit, BuilderDirective* paDire
 		// distance weight
 		// find how many turns the plot is away
 		int iMoveTurnsAway = FindTurnsAway(pUnit, pPlot);
+#endif // AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
 		if(iMoveTurnsAway < 0)
 		{
 			if(m_bLogging)
@@ -1068,12 +1094,16 @@ void CvBuilderTaskingAI::AddImprovingResourcesDirectives(CvUnit* pUnit, CvPlot*
 		iWeight += GetResourceWeight(eResource, eImprovement, pPlot->getNumResource());
 		iWeight = CorrectWeight(iWeight);
 
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+		int iScore = GetBuildScore(pPlot, eBuild, eFeatureType != NO_FEATURE && pkBuild->isFeatureRemove(eFeatureType) && pkBuild->getFeatureProduction(eFeatureType) > 0);
+#else
 		UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
 		int iScore = ScorePlot(eFeatureType != NO_FEATURE && pkBuild->isFeatureRemove(eFeatureType) && pkBuild->getFeatureProduction(eFeatureType) > 0);
 #else
 		int iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 		if(iScore > 0)
 		{
 			iWeight *= iScore;
@@ -1379,12 +1409,16 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 		int iScore = 0;
 		if (pCity)
 		{
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+			iScore = GetBuildScore(pPlot, eBuild, bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
+#else
 			UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
 			iScore = ScorePlot(bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
 #else
 			iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 		}
 		if (!pCity || iScore > 0)
 		{
@@ -1393,6 +1427,9 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 				GC.getTerrainInfo(pPlot->getTerrainType())->getDefenseModifier() + GC.getFLAT_LAND_EXTRA_DEFENSE()));
 			iScore += (pImprovement->GetDefenseModifier() + iBaseDefenseBonus) * pPlot->getStrategicValue(false) / (100 * GC.getCHOKEPOINT_STRATEGIC_VALUE());
 		}
+#else
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+		int iScore = GetBuildScore(pPlot, eBuild, bWillRemoveForestOrJungle && pkBuild->getFeatureProduction(eFeature) > 0);
 #else
 		UpdateProjectedPlotYields(pPlot, eBuild);
 #ifdef AUI_WORKER_SCORE_PLOT_CHOP
@@ -1400,6 +1437,7 @@ void CvBuilderTaskingAI::AddImprovingPlotsDirectives(CvUnit* pUnit, CvPlot* pPlo
 #else
 		int iScore = ScorePlot();
 #endif // AUI_WORKER_SCORE_PLOT_CHOP
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 #endif // AUI_WORKER_ADD_IMPROVING_PLOTS_DIRECTIVE_DEFENSIVES
 
 		// if we're going backward, bail out!
@@ -3404,3 +3442,98 @@ void CvBuilderTaskingAI::UpdateProjectedPlotYields(CvPlot* pPlot, BuildTypes eBu
 		}
 	}
 }
+
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+/// Score of building eBuild on pPlot, computed at most once per turn per plot state (score doesn't depend on which worker is asking)
+int CvBuilderTaskingAI::GetBuildScore(CvPlot* pPlot, BuildTypes eBuild, bool bWillChop)
+{
+	const int iNumBuilds = GC.getNumBuildInfos();
+	const int iNumPlots = GC.getMap().numPlots();
+	const int iTurn = GC.getGame().getGameTurn();
+	if(m_iBuildScoreCacheTurn != iTurn || (int)m_aiBuildScoreSlot.size() != iNumPlots)
+	{
+		m_iBuildScoreCacheTurn = iTurn;
+		m_aiBuildScoreSlot.assign(iNumPlots, -1);
+		m_aiBuildScoreSlotSignature.clear();
+		m_aiBuildScores.clear();
+	}
+
+	// Two scores per build: with and without chopping
+	const int iSlotSize = iNumBuilds * 2;
+	const int iPlotIndex = pPlot->GetPlotIndex();
+	const int iSignature = GetBuildScorePlotSignature(pPlot);
+	int iSlot = m_aiBuildScoreSlot[iPlotIndex];
+	if(iSlot < 0)
+	{
+		iSlot = (int)m_aiBuildScoreSlotSignature.size();
+		m_aiBuildScoreSlot[iPlotIndex] = iSlot;
+		m_aiBuildScoreSlotSignature.push_back(iSignature);
+		m_aiBuildScores.resize(m_aiBuildScores.size() + iSlotSize, MIN_INT);
+	}
+	else if(m_aiBuildScoreSlotSignature[iSlot] != iSignature)
+	{
+		// Plot changed since it was scored, so none of its scores are valid anymore
+		m_aiBuildScoreSlotSignature[iSlot] = iSignature;
+		std::fill(m_aiBuildScores.begin() + iSlot * iSlotSize, m_aiBuildScores.begin() + (iSlot + 1) * iSlotSize, MIN_INT);
+	}
+
+	int& iScore = m_aiBuildScores[iSlot * iSlotSize + eBuild * 2 + (bWillChop ? 1 : 0)];
+	if(iScore == MIN_INT)
+	{
+		UpdateProjectedPlotYields(pPlot, eBuild);
+#ifdef AUI_WORKER_SCORE_PLOT_CHOP
+		iScore = ScorePlot(bWillChop);
+#else
+		iScore = ScorePlot();
+#endif // AUI_WORKER_SCORE_PLOT_CHOP
+	}
+	return iScore;
+}
+
+/// Hash of the plot state that build scores depend on
+int CvBuilderTaskingAI::GetBuildScorePlotSignature(CvPlot* pPlot) const
+{
+	CvCity* pWorkingCity = pPlot->getWorkingCity();
+	int iSignature = pPlot->getImprovementType();
+	iSignature = iSignature * 31 + (pPlot->IsImprovementPillaged() ? 1 : 0);
+	iSignature = iSignature * 31 + pPlot->getFeatureType();
+	iSignature = iSignature * 31 + pPlot->getRouteType();
+	iSignature = iSignature * 31 + pPlot->getResourceType(m_pPlayer->getTeam());
+	iSignature = iSignature * 31 + pPlot->getOwner();
+	iSignature = iSignature * 31 + (pWorkingCity ? pWorkingCity->GetID() : -1);
+	return iSignature;
+}
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
+
+#ifdef AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+/// Fills aiTurnsAway (parallel to m_aiPlots) with FindTurnsAway() results for plots the builder should consider, -2 for the rest; plots are queried nearest first
+void CvBuilderTaskingAI::FindTurnsAwayNearestFirst(CvUnit* pUnit, std::vector<int>& aiTurnsAway)
+{
+	aiTurnsAway.assign(m_aiPlots.size(), -2);
+
+	std::vector< std::pair<int, uint> > aCandidates;
+	aCandidates.reserve(m_aiPlots.size());
+	for(uint uiPlotIndex = 0; uiPlotIndex < m_aiPlots.size(); uiPlotIndex++)
+	{
+		// when we encounter the first plot that is invalid, the rest of the list will be invalid
+		if(m_aiPlots[uiPlotIndex] == -1)
+		{
+			break;
+		}
+
+		CvPlot* pPlot = GC.getMap().plotByIndex(m_aiPlots[uiPlotIndex]);
+		if(!ShouldBuilderConsiderPlot(pUnit, pPlot))
+		{
+			continue;
+		}
+		aCandidates.push_back(std::make_pair(plotDistance(pUnit->getX(), pUnit->getY(), pPlot->getX(), pPlot->getY()), uiPlotIndex));
+	}
+
+	std::sort(aCandidates.begin(), aCandidates.end());
+	for(uint ui = 0; ui < aCandidates.size(); ui++)
+	{
+		uint uiPlotIndex = aCandidates[ui].second;
+		aiTurnsAway[uiPlotIndex] = FindTurnsAway(pUnit, GC.getMap().plotByIndex(m_aiPlots[uiPlotIndex]));
+	}
+}
+#endif // AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
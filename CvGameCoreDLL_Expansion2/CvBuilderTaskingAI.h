@@ -128,6 +128,13 @@ protected:
 
 	void UpdateCurrentPlotYields(CvPlot* pPlot);
 	void UpdateProjectedPlotYields(CvPlot* pPlot, BuildTypes eBuild);
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+	int GetBuildScore(CvPlot* pPlot, BuildTypes eBuild, bool bWillChop);
+	int GetBuildScorePlotSignature(CvPlot* pPlot) const;
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
+#ifdef AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
+	void FindTurnsAwayNearestFirst(CvUnit* pUnit, std::vector<int>& aiTurnsAway);
+#endif // AUI_WORKER_NEAREST_FIRST_TURNS_AWAY
 
 	CvPlayer* m_pPlayer;
 	BuildTypes m_eRepairBuild;
@@ -144,6 +151,14 @@ protected:
 
 	bool m_bKeepMarshes;
 	bool m_bKeepJungle;
+
+#ifdef AUI_WORKER_SHARED_BUILD_SCORES
+	// Per-turn build score cache (not serialized); scores of a plot live in slot m_aiBuildScoreSlot[plot index]
+	int m_iBuildScoreCacheTurn;
+	std::vector<int> m_aiBuildScoreSlot;
+	std::vector<int> m_aiBuildScoreSlotSignature;
+	std::vector<int> m_aiBuildScores;
+#endif // AUI_WORKER_SHARED_BUILD_SCORES
 };
 
 #endif //CIV5_BUILDER_TASKING_AI_H
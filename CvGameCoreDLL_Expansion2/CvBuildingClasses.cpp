@@ -151,6 +151,9 @@ CvBuildingEntry::CvBuildingEntry(void):
 	m_bAllowsFoodTradeRoutes(false),
 	m_bAllowsProductionTradeRoutes(false),
 	m_bNullifyInfluenceModifier(false),
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	m_uiBuildingFlags(0),
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 	m_piLockedBuildingClasses(NULL),
 	m_piPrereqAndTechs(NULL),
 	m_piResourceQuantityRequirements(NULL),
@@ -280,6 +283,11 @@ bool CvBuildingEntry::CacheResults(Database::Results& kResults, CvDatabaseUtilit
 	m_bAllowsFoodTradeRoutes = kResults.GetBool("AllowsFoodTradeRoutes");
 	m_bAllowsProductionTradeRoutes = kResults.GetBool("AllowsProductionTradeRoutes");
 	m_bNullifyInfluenceModifier = kResults.GetBool("NullifyInfluenceModifier");
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	m_uiBuildingFlags = 0;
+	if (m_bNullifyInfluenceModifier)
+		m_uiBuildingFlags |= (1 << BUILDING_FLAG_NULLIFY_INFLUENCE_MODIFIER);
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 	m_iNumCityCostMod = kResults.GetInt("NumCityCostMod");
 	m_iHurryCostModifier = kResults.GetInt("HurryCostModifier");
 	m_iMinAreaSize = kResults.GetInt("MinAreaSize");
@@ -475,6 +483,18 @@ bool CvBuildingEntry::CacheResults(Database::Results& kResults, CvDatabaseUtilit
 
 	kUtility.PopulateArrayByValue(m_piPrereqNumOfBuildingClass, "BuildingClasses", "Building_PrereqBuildingClasses", "BuildingClassType", "BuildingType", szBuildingType, "NumBuildingNeeded");
 	kUtility.PopulateArrayByExistence(m_pbBuildingClassNeededInCity, "BuildingClasses", "Building_ClassesNeededInCity", "BuildingClassType", "BuildingType", szBuildingType);
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	m_aiBuildingClassesNeededInCity.clear();
+	if (m_pbBuildingClassNeededInCity)
+	{
+		const int iNumBuildingClasses = kUtility.MaxRows("BuildingClasses");
+		for (int iI = 0; iI < iNumBuildingClasses; iI++)
+		{
+			if (m_pbBuildingClassNeededInCity[iI])
+				m_aiBuildingClassesNeededInCity.push_back(iI);
+		}
+	}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 	//kUtility.PopulateArrayByExistence(m_piNumFreeUnits, "Units", "Building_FreeUnits", "UnitType", "BuildingType", szBuildingType);
 	kUtility.PopulateArrayByValue(m_piNumFreeUnits, "Units", "Building_FreeUnits", "UnitType", "BuildingType", szBuildingType, "NumUnits");
 	kUtility.PopulateArrayByValue(m_paiBuildingClassHappiness, "BuildingClasses", "Building_BuildingClassHappiness", "BuildingClassType", "BuildingType", szBuildingType, "Happiness");
@@ -1438,6 +1458,14 @@ bool CvBuildingEntry::NullifyInfluenceModifier() const
 	return m_bNullifyInfluenceModifier;
 }
 
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+/// Bitmask of BuildingFlagTypes that apply to this building
+uint CvBuildingEntry::GetBuildingFlags() const
+{
+	return m_uiBuildingFlags;
+}
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
+
 /// Does this building define the capital?
 bool CvBuildingEntry::IsCapital() const
 {
@@ -1859,6 +1887,14 @@ bool CvBuildingEntry::IsBuildingClassNeededInCity(int i) const
 	return m_pbBuildingClassNeededInCity ? m_pbBuildingClassNeededInCity[i] : false;
 }
 
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+/// List of BuildingClasses that must already be in a city for this Building to be built there
+const std::vector<int>& CvBuildingEntry::GetBuildingClassesNeededInCity() const
+{
+	return m_aiBuildingClassesNeededInCity;
+}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+
 /// Free units which appear near the capital
 int CvBuildingEntry::GetNumFreeUnits(int i) const
 {
@@ -2026,6 +2062,9 @@ void CvBuildingXMLEntries::DeleteArray()
 	}
 
 	m_paBuildingEntries.clear();
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	m_aaiMutuallyExclusiveGroups.clear();
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 }
 
 /// Get a specific entry
@@ -2034,6 +2073,32 @@ CvBuildingEntry* CvBuildingXMLEntries::GetEntry(int index)
 	return m_paBuildingEntries[index];
 }
 
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+/// Builds the index of buildings by mutually exclusive group; called once all building entries have been loaded
+void CvBuildingXMLEntries::CacheMutuallyExclusiveGroups()
+{
+	m_aaiMutuallyExclusiveGroups.clear();
+	for (uint uiI = 0; uiI < m_paBuildingEntries.size(); uiI++)
+	{
+		const CvBuildingEntry* pkEntry = m_paBuildingEntries[uiI];
+		if (pkEntry && pkEntry->GetMutuallyExclusiveGroup() != -1)
+			m_aaiMutuallyExclusiveGroups[pkEntry->GetMutuallyExclusiveGroup()].push_back((int)uiI);
+	}
+}
+
+/// Buildings that belong to a mutually exclusive group
+const std::vector<int>& CvBuildingXMLEntries::GetBuildingsInMutuallyExclusiveGroup(int iGroup) const
+{
+	static const std::vector<int> s_aiNoBuildings;
+
+	std::map<int, std::vector<int> >::const_iterator it = m_aaiMutuallyExclusiveGroups.find(iGroup);
+	if (it == m_aaiMutuallyExclusiveGroups.end())
+		return s_aiNoBuildings;
+
+	return it->second;
+}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+
 //=====================================
 // CvCityBuildings
 //=====================================
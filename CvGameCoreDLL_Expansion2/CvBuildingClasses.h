@@ -223,6 +223,9 @@ public:
 	bool AllowsFoodTradeRoutes() const;
 	bool AllowsProductionTradeRoutes() const;
 	bool NullifyInfluenceModifier() const;
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	uint GetBuildingFlags() const;
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 
 	const char* GetArtDefineTag() const;
 	void SetArtDefineTag(const char* szVal);
@@ -277,6 +280,9 @@ public:
 	int GetLocalResourceOr(int i) const;
 	int GetHurryModifier(int i) const;
 	bool IsBuildingClassNeededInCity(int i) const;
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	const std::vector<int>& GetBuildingClassesNeededInCity() const;
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 	int GetNumFreeUnits(int i) const;
 
 	int GetResourceYieldChange(int i, int j) const;
@@ -436,6 +442,9 @@ private:
 	bool m_bAllowsFoodTradeRoutes;
 	bool m_bAllowsProductionTradeRoutes;
 	bool m_bNullifyInfluenceModifier;
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	uint m_uiBuildingFlags;
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 
 	bool m_bArtInfoCulturalVariation;
 	bool m_bArtInfoEraVariation;
@@ -477,6 +486,9 @@ private:
 	int* m_paiHurryModifier;
 
 	bool* m_pbBuildingClassNeededInCity;
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	std::vector<int> m_aiBuildingClassesNeededInCity;
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 	int* m_piNumFreeUnits;
 
 	int** m_ppaiResourceYieldChange;
@@ -512,11 +524,18 @@ public:
 	std::vector<CvBuildingEntry*>& GetBuildingEntries();
 	int GetNumBuildings();
 	_Ret_maybenull_ CvBuildingEntry* GetEntry(int index);
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	void CacheMutuallyExclusiveGroups();
+	const std::vector<int>& GetBuildingsInMutuallyExclusiveGroup(int iGroup) const;
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 
 	void DeleteArray();
 
 private:
 	std::vector<CvBuildingEntry*> m_paBuildingEntries;
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	std::map<int, std::vector<int> > m_aaiMutuallyExclusiveGroups;
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
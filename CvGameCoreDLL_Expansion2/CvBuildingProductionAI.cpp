@@ -143,6 +143,29 @@ void CvBuildingProductionAI::AddFlavorWeights(FlavorTypes eFlavor, int iWeight)
 	}
 }
 
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+/// Establish weights for all flavors at once (one weight per flavor, indexed by flavor type)
+void CvBuildingProductionAI::AddFlavorWeights(const int* paiFlavorWeights)
+{
+	CvBuildingXMLEntries* pkBuildings = m_pCityBuildings->GetBuildings();
+	const int iNumFlavors = GC.getNumFlavorTypes();
+
+	for(int iBuilding = 0; iBuilding < pkBuildings->GetNumBuildings(); iBuilding++)
+	{
+		CvBuildingEntry* entry = pkBuildings->GetEntry(iBuilding);
+		if(entry)
+		{
+			int iWeight = 0;
+			for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+			{
+				iWeight += entry->GetFlavorValue(iFlavor) * paiFlavorWeights[iFlavor];
+			}
+			m_BuildingAIWeights.IncreaseWeight(iBuilding, iWeight);
+		}
+	}
+}
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+
 /// Retrieve sum of weights on one item
 int CvBuildingProductionAI::GetWeight(BuildingTypes eBuilding)
 {
@@ -518,6 +518,10 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 
 	PlayerTypes ePlayer;
 
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	GC.getGame().AddCityToDistanceMatrix(*this);
+
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
 	// Update Proximity between this Player and all others
 	for(int iPlayerLoop = 0; iPlayerLoop < MAX_CIV_PLAYERS; iPlayerLoop++)
 	{
@@ -2521,6 +2525,28 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 		return false;
 
 	// Does this city have prereq buildings?
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	const std::vector<int>& aiBuildingClassesNeeded = pkBuildingInfo->GetBuildingClassesNeededInCity();
+	for (std::vector<int>::const_iterator it = aiBuildingClassesNeeded.begin(); it != aiBuildingClassesNeeded.end(); ++it)
+	{
+		iI = *it;
+		CvBuildingClassInfo* pkBuildingClassInfo = GC.getBuildingClassInfo((BuildingClassTypes)iI);
+		if(!pkBuildingClassInfo)
+		{
+			continue;
+		}
+
+		ePrereqBuilding = ((BuildingTypes)(thisCivInfo.getCivilizationBuildings(iI)));
+
+		if(ePrereqBuilding != NO_BUILDING)
+		{
+			if(0 == m_pCityBuildings->GetNumBuilding(ePrereqBuilding))
+			{
+				return false;
+			}
+		}
+	}
+#else
 	for(iI = 0; iI < iNumBuildingClassInfos; iI++)
 	{
 		CvBuildingClassInfo* pkBuildingClassInfo = GC.getBuildingClassInfo((BuildingClassTypes)iI);
@@ -2542,6 +2568,7 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 			}
 		}
 	}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 
 	///////////////////////////////////////////////////////////////////////////////////
 	// Everything above this is what is checked to see if Building shows up in the list of construction items
@@ -2596,6 +2623,13 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 	{
 		BuildingClassTypes eLockedBuildingClass = (BuildingClassTypes) pkBuildingInfo->GetLockedBuildingClasses(iI);
 
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+		// Locked classes are stored front-packed and terminated by -1
+		if(eLockedBuildingClass == NO_BUILDINGCLASS)
+		{
+			break;
+		}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 		if(eLockedBuildingClass != NO_BUILDINGCLASS)
 		{
 			BuildingTypes eLockedBuilding = (BuildingTypes)(thisCivInfo.getCivilizationBuildings(eLockedBuildingClass));
@@ -2613,6 +2647,17 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 	// Mutually Exclusive Buildings 2
 	if(pkBuildingInfo->GetMutuallyExclusiveGroup() != -1)
 	{
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+		// Buildings are in a Mutually Exclusive Group, so only one is allowed
+		const std::vector<int>& aiGroupBuildings = GC.GetGameBuildings()->GetBuildingsInMutuallyExclusiveGroup(pkBuildingInfo->GetMutuallyExclusiveGroup());
+		for (std::vector<int>::const_iterator it = aiGroupBuildings.begin(); it != aiGroupBuildings.end(); ++it)
+		{
+			if(m_pCityBuildings->GetNumBuilding((BuildingTypes)*it) > 0)
+			{
+				return false;
+			}
+		}
+#else
 		int iNumBuildingInfos = GC.getNumBuildingInfos();
 		for(iI = 0; iI < iNumBuildingInfos; iI++)
 		{
@@ -2631,6 +2676,7 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 				}
 			}
 		}
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 	}
 
 
@@ -6215,6 +6261,9 @@ void CvCity::processBuilding(BuildingTypes eBuilding, int iChange, bool bFirst,
 
 		owningTeam.changeBuildingClassCount(eBuildingClass, iChange);
 		owningPlayer.changeBuildingClassCount(eBuildingClass, iChange);
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+		owningPlayer.ChangeNumBuildingsWithFlags(pBuildingInfo->GetBuildingFlags(), iChange);
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 	}
 
 	UpdateReligion(GetCityReligions()->GetReligiousMajority());
@@ -6277,6 +6326,9 @@ void CvCity::processSpecialist(SpecialistTypes eSpecialist, int iChange)
 /// Process the majority religion changing for a city
 void CvCity::UpdateReligion(ReligionTypes eNewMajority)
 {
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 	updateYield();
 
 	// Reset city level yields
@@ -9403,6 +9455,16 @@ int CvCity::getYieldRate(YieldTypes eIndex, bool bIgnoreTrade) const
 int CvCity::getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade) const
 {
 	VALIDATE_OBJECT
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+	return getYieldRateTimes100(eIndex, bIgnoreTrade, NULL);
+}
+
+//	--------------------------------------------------------------------------------
+/// If piProductionTimes100 is set, it is used as the city's production (including trade) when processes convert production into eIndex instead of computing it again
+int CvCity::getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade, const int* piProductionTimes100) const
+{
+	VALIDATE_OBJECT
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 
 	// Resistance - no Science, Gold or Production (Prod handled in ProductionDifference)
 	if(IsResistance() || IsRazing())
@@ -9419,7 +9481,12 @@ int CvCity::getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade) const
 	{
 		CvAssertMsg(eIndex != YIELD_PRODUCTION, "GAMEPLAY: should not be trying to convert Production into Production via process.");
 
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+		const int iProductionTimes100 = piProductionTimes100 ? *piProductionTimes100 : getYieldRateTimes100(YIELD_PRODUCTION, false);
+		iProcessYield = iProductionTimes100 * getProductionToYieldModifier(eIndex) / 100;
+#else
 		iProcessYield = getYieldRateTimes100(YIELD_PRODUCTION, false) * getProductionToYieldModifier(eIndex) / 100;
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 	}
 
 	// Sum up yield rate
@@ -9441,6 +9508,43 @@ int CvCity::getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade) const
 	return iModifiedYield;
 }
 
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+//	--------------------------------------------------------------------------------
+/// Same as getYieldRateTimes100() for every yield in uiYieldMask (bit per YieldTypes), but production is only computed once even if processes convert it into other yields
+void CvCity::getYieldRatesTimes100(int* aiYieldRatesTimes100, bool bIgnoreTrade, uint uiYieldMask) const
+{
+	VALIDATE_OBJECT
+
+	int iProductionTimes100 = 0;
+	const int* piProductionTimes100 = NULL;
+
+	for(int iI = 0; iI < NUM_YIELD_TYPES; iI++)
+	{
+		const YieldTypes eYield = (YieldTypes)iI;
+		if(!(uiYieldMask & (1 << iI)))
+		{
+			aiYieldRatesTimes100[iI] = 0;
+			continue;
+		}
+
+		if(!piProductionTimes100 && getProductionToYieldModifier(eYield) != 0)
+		{
+			iProductionTimes100 = getYieldRateTimes100(YIELD_PRODUCTION, false);
+			piProductionTimes100 = &iProductionTimes100;
+		}
+
+		aiYieldRatesTimes100[iI] = getYieldRateTimes100(eYield, bIgnoreTrade, piProductionTimes100);
+
+		// Processes convert production including trade, so it can only be reused if trade was counted
+		if(eYield == YIELD_PRODUCTION && !bIgnoreTrade)
+		{
+			iProductionTimes100 = aiYieldRatesTimes100[iI];
+			piProductionTimes100 = &iProductionTimes100;
+		}
+	}
+}
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
+
 
 //	--------------------------------------------------------------------------------
 int CvCity::getBaseYieldRate(YieldTypes eIndex) const
@@ -13697,6 +13801,13 @@ void CvCity::read(FDataStream& kStream)
 	kStream >> m_iDamage;
 	kStream >> m_iThreatValue;
 	kStream >> m_iGarrisonedUnit;
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	// Dense indices are remapped through the type dictionaries read by CvPlayer::Read()
+	bool bTypeDictionary = (uiVersion >= 7);
+	if (bTypeDictionary)
+		m_iResourceDemanded = CvInfosSerializationHelper::ReadDenseType<ResourceTypes>(kStream);
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	m_iResourceDemanded = CvInfosSerializationHelper::ReadHashed(kStream);
 	kStream >> m_iWeLoveTheKingDayCounter;
 	kStream >> m_iLastTurnGarrisonAssigned;
@@ -13761,9 +13872,22 @@ void CvCity::read(FDataStream& kStream)
 	kStream >> m_strName;
 	kStream >> m_strScriptData;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNoResource.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiFreeResource.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNumResourcesLocal.dirtyGet());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNoResource.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreeResource.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResourcesLocal.dirtyGet());
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream >> m_paiSpecialistProduction;
 	kStream >> m_paiProjectProduction;
@@ -13791,8 +13915,20 @@ void CvCity::read(FDataStream& kStream)
 		}
 	}
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<UnitTypes>(kStream, m_paiUnitProduction.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<UnitTypes>(kStream, m_paiUnitProductionTime.dirtyGet());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiUnitProduction.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiUnitProductionTime.dirtyGet());
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream >> m_paiSpecialistCount;
 	kStream >> m_paiMaxSpecialistCount;
@@ -13802,6 +13938,11 @@ void CvCity::read(FDataStream& kStream)
 	kStream >> m_paiUnitCombatFreeExperience;
 	kStream >> m_paiUnitCombatProductionModifier;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+		CvInfosSerializationHelper::ReadDenseDataArray<PromotionTypes>(kStream, m_paiFreePromotionCount.dirtyGet());
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreePromotionCount.dirtyGet());
 
 	UINT uLength;
@@ -13890,11 +14031,26 @@ void CvCity::read(FDataStream& kStream)
 			m_orderQueue.insertAtEnd(&Data);
 	}
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_ppaiResourceYieldChange, NUM_YIELD_TYPES, GC.getNumResourceInfos());
+
+		CvInfosSerializationHelper::ReadDenseDataArray<FeatureTypes>(kStream, m_ppaiFeatureYieldChange, NUM_YIELD_TYPES, GC.getNumFeatureInfos());
+
+		CvInfosSerializationHelper::ReadDenseDataArray<TerrainTypes>(kStream, m_ppaiTerrainYieldChange, NUM_YIELD_TYPES, GC.getNumTerrainInfos());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_ppaiResourceYieldChange, NUM_YIELD_TYPES, GC.getNumResourceInfos());
 
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_ppaiFeatureYieldChange, NUM_YIELD_TYPES, GC.getNumFeatureInfos());
 
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_ppaiTerrainYieldChange, NUM_YIELD_TYPES, GC.getNumTerrainInfos());
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream >> m_iPopulationRank;
 	kStream >> m_bPopulationRankValid;
@@ -13963,7 +14119,11 @@ void CvCity::write(FDataStream& kStream) const
 	VALIDATE_OBJECT
 
 	// Current version number
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	uint uiVersion = 7;
+#else
 	uint uiVersion = 6;
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	kStream << uiVersion;
 
 	kStream << m_iID;
@@ -14020,7 +14180,11 @@ void CvCity::write(FDataStream& kStream) const
 	kStream << m_iDamage;
 	kStream << m_iThreatValue;
 	kStream << m_iGarrisonedUnit;
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseType(kStream, m_iResourceDemanded.get());
+#else
 	CvInfosSerializationHelper::WriteHashed(kStream, (ResourceTypes)(m_iResourceDemanded.get()));
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	kStream << m_iWeLoveTheKingDayCounter;
 	kStream << m_iLastTurnGarrisonAssigned;
 	kStream << m_iThingsProduced;
@@ -14074,17 +14238,28 @@ void CvCity::write(FDataStream& kStream) const
 	kStream << m_strName;
 	kStream << m_strScriptData;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiNoResource);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiFreeResource);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiNumResourcesLocal);
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiNoResource);
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiFreeResource);
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiNumResourcesLocal);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream << m_paiSpecialistProduction;
 	kStream << m_paiProjectProduction;
 
 	m_pCityBuildings->Write(kStream);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiUnitProduction);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiUnitProductionTime);
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<UnitTypes, int>(kStream, m_paiUnitProduction);
 	CvInfosSerializationHelper::WriteHashedDataArray<UnitTypes, int>(kStream, m_paiUnitProductionTime);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream << m_paiSpecialistCount;
 	kStream << m_paiMaxSpecialistCount;
@@ -14094,7 +14269,11 @@ void CvCity::write(FDataStream& kStream) const
 	kStream << m_paiUnitCombatFreeExperience;
 	kStream << m_paiUnitCombatProductionModifier;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiFreePromotionCount);
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<PromotionTypes, int>(kStream, m_paiFreePromotionCount);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	//  Write m_orderQueue
 	UINT uLength = (UINT)m_orderQueue.getLength();
@@ -14142,11 +14321,19 @@ void CvCity::write(FDataStream& kStream) const
 		kStream << pData->bRush;
 	}
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_ppaiResourceYieldChange, NUM_YIELD_TYPES, GC.getNumResourceInfos());
+
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_ppaiFeatureYieldChange, NUM_YIELD_TYPES, GC.getNumFeatureInfos());
+
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_ppaiTerrainYieldChange, NUM_YIELD_TYPES, GC.getNumTerrainInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes>(kStream, m_ppaiResourceYieldChange, NUM_YIELD_TYPES, GC.getNumResourceInfos());
 
 	CvInfosSerializationHelper::WriteHashedDataArray<FeatureTypes>(kStream, m_ppaiFeatureYieldChange, NUM_YIELD_TYPES, GC.getNumFeatureInfos());
 
 	CvInfosSerializationHelper::WriteHashedDataArray<TerrainTypes>(kStream, m_ppaiTerrainYieldChange, NUM_YIELD_TYPES, GC.getNumTerrainInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream << m_iPopulationRank;
 	kStream << m_bPopulationRankValid;
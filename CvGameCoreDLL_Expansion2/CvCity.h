@@ -558,6 +558,10 @@ public:
 	int getBaseYieldRateModifier(YieldTypes eIndex, int iExtra = 0, CvString* toolTipSink = NULL) const;
 	int getYieldRate(YieldTypes eIndex, bool bIgnoreTrade) const;
 	int getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade) const;
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+	int getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade, const int* piProductionTimes100) const;
+	void getYieldRatesTimes100(int* aiYieldRatesTimes100, bool bIgnoreTrade, uint uiYieldMask) const;
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 
 	// Base Yield
 	int getBaseYieldRate(YieldTypes eIndex) const;
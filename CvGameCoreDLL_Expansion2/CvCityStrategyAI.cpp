@@ -379,6 +379,47 @@ void CvCityStrategyAI::FlavorUpdate()
 	m_pProjectProductionAI->Reset();
 	m_pProcessProductionAI->Reset();
 
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+	const int iNumFlavors = GC.getNumFlavorTypes();
+	int* paiFlavorWeights = (int*)_alloca(sizeof(int) * iNumFlavors);
+#ifdef AUI_GS_SCIENCE_FLAVOR_BOOST
+	// Processes get the unboosted science flavor
+	int* paiProcessFlavorWeights = (int*)_alloca(sizeof(int) * iNumFlavors);
+	const FlavorTypes eScienceFlavor = (FlavorTypes)GC.getInfoTypeForString("FLAVOR_SCIENCE");
+#endif // AUI_GS_SCIENCE_FLAVOR_BOOST
+#ifdef AUI_CITYSTRATEGY_FIX_CHOOSE_PRODUCTION_PUPPETS_NULLIFY_BARRACKS
+	const bool bPuppet = GetCity()->IsPuppet();
+	const FlavorTypes eMilitaryTrainingFlavor = (FlavorTypes)GC.getInfoTypeForString("FLAVOR_MILITARY_TRAINING");
+	const FlavorTypes eNavalFlavor = (FlavorTypes)GC.getInfoTypeForString("FLAVOR_NAVAL");
+#endif // AUI_CITYSTRATEGY_FIX_CHOOSE_PRODUCTION_PUPPETS_NULLIFY_BARRACKS
+
+	for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+	{
+		int iFlavorValue = GetLatestFlavorValue((FlavorTypes)iFlavor);
+#ifdef AUI_CITYSTRATEGY_FIX_CHOOSE_PRODUCTION_PUPPETS_NULLIFY_BARRACKS
+		if (bPuppet && ((FlavorTypes)iFlavor == eMilitaryTrainingFlavor || (FlavorTypes)iFlavor == eNavalFlavor))
+			iFlavorValue = 0;
+#endif // AUI_CITYSTRATEGY_FIX_CHOOSE_PRODUCTION_PUPPETS_NULLIFY_BARRACKS
+#ifdef AUI_GS_SCIENCE_FLAVOR_BOOST
+		paiProcessFlavorWeights[iFlavor] = iFlavorValue;
+		if ((FlavorTypes)iFlavor == eScienceFlavor)
+		{
+			iFlavorValue = GET_PLAYER(m_pCity->getOwner()).GetGrandStrategyAI()->ScienceFlavorBoost() * MAX(1, iFlavorValue);
+		}
+#endif // AUI_GS_SCIENCE_FLAVOR_BOOST
+		paiFlavorWeights[iFlavor] = iFlavorValue;
+	}
+
+	// Broadcast to our sub AI objects
+	m_pBuildingProductionAI->AddFlavorWeights(paiFlavorWeights);
+	m_pUnitProductionAI->AddFlavorWeights(paiFlavorWeights);
+	m_pProjectProductionAI->AddFlavorWeights(paiFlavorWeights);
+#ifdef AUI_GS_SCIENCE_FLAVOR_BOOST
+	m_pProcessProductionAI->AddFlavorWeights(paiProcessFlavorWeights);
+#else
+	m_pProcessProductionAI->AddFlavorWeights(paiFlavorWeights);
+#endif // AUI_GS_SCIENCE_FLAVOR_BOOST
+#else
 	// Broadcast to our sub AI objects
 	for(int iFlavor = 0; iFlavor < GC.getNumFlavorTypes(); iFlavor++)
 	{
@@ -405,6 +446,7 @@ void CvCityStrategyAI::FlavorUpdate()
 		m_pProcessProductionAI->AddFlavorWeights((FlavorTypes)iFlavor, iFlavorValue);
 #endif // AUI_GS_SCIENCE_FLAVOR_BOOST
 	}
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
 }
 
 /// Runs through all active player strategies and propagates Flavors down to this City
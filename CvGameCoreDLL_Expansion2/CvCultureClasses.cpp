@@ -106,6 +106,12 @@ CvGameCulture::CvGameCulture(void)
 	m_CurrentGreatWorks.clear();
 
 	m_bReportedSomeoneInfluential = false;
+
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	memset(m_aaaiTourismModifiers, 0, sizeof(m_aaaiTourismModifiers));
+	m_iTourismModifierMatrixTurn = -1;
+	m_bTourismModifierMatrixDirty = true;
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 }
 
 /// Destructor
@@ -116,6 +122,10 @@ CvGameCulture::~CvGameCulture(void)
 /// Run the turn culture computations for all the players
 void CvGameCulture::DoTurn()
 {
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	SetTourismModifierMatrixDirty();
+
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 	for (uint uiPlayer = 0; uiPlayer < MAX_MAJOR_CIVS; uiPlayer++)
 	{
 		PlayerTypes ePlayer = (PlayerTypes)uiPlayer;
@@ -622,6 +632,255 @@ int CvGameCulture::GetNumCivsInfluentialForWin() const
 	return iAliveMajors - 1;  // Don't have to be influential over yourself
 }
 
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+/// Part of the tourism modifier eFromPlayer's tourism gets against eToPlayer (served from the matrix for living major civs)
+int CvGameCulture::GetTourismModifierComponent(PlayerTypes eFromPlayer, PlayerTypes eToPlayer, TourismModifierComponentTypes eComponent) const
+{
+	CvAssertMsg(eComponent >= 0 && eComponent < NUM_TOURISM_MODIFIER_COMPONENTS, "Invalid tourism modifier component");
+
+	if (eFromPlayer < 0 || eFromPlayer >= MAX_MAJOR_CIVS || eToPlayer < 0 || eToPlayer >= MAX_MAJOR_CIVS ||
+		!GET_PLAYER(eFromPlayer).isAlive() || !GET_PLAYER(eToPlayer).isAlive())
+	{
+		return ComputeTourismModifierComponent(eFromPlayer, eToPlayer, eComponent);
+	}
+
+	if (m_bTourismModifierMatrixDirty || m_iTourismModifierMatrixTurn != GC.getGame().getGameTurn())
+	{
+		RebuildTourismModifierMatrix();
+	}
+
+	return m_aaaiTourismModifiers[eFromPlayer][eToPlayer][eComponent];
+}
+
+/// Computes one tourism modifier component from scratch (same logic as CvCityCulture::GetTourismMultiplier())
+int CvGameCulture::ComputeTourismModifierComponent(PlayerTypes eFromPlayer, PlayerTypes eToPlayer, TourismModifierComponentTypes eComponent)
+{
+	CvPlayer &kFromPlayer = GET_PLAYER(eFromPlayer);
+	CvPlayer &kToPlayer = GET_PLAYER(eToPlayer);
+	int iMultiplier = 0;
+
+	switch (eComponent)
+	{
+	case TOURISM_MODIFIER_COMPONENT_SHARED_RELIGION:
+		{
+			ReligionTypes ePlayerReligion = kFromPlayer.GetReligions()->GetReligionInMostCities();
+			if (ePlayerReligion != NO_RELIGION && kToPlayer.GetReligions()->HasReligionInMostCities(ePlayerReligion))
+			{
+				iMultiplier += kFromPlayer.GetCulture()->GetTourismModifierSharedReligion();
+			}
+		}
+		break;
+	case TOURISM_MODIFIER_COMPONENT_OPEN_BORDERS:
+		if (GET_TEAM(kToPlayer.getTeam()).IsAllowsOpenBordersToTeam(kFromPlayer.getTeam()))
+		{
+			iMultiplier += kFromPlayer.GetCulture()->GetTourismModifierOpenBorders();
+		}
+		break;
+	case TOURISM_MODIFIER_COMPONENT_TRADE_ROUTE:
+		if (GC.getGame().GetGameTrade()->IsPlayerConnectedToPlayer(eFromPlayer, eToPlayer))
+		{
+			iMultiplier += kFromPlayer.GetCulture()->GetTourismModifierTradeRoute();
+		}
+		break;
+	case TOURISM_MODIFIER_COMPONENT_IDEOLOGIES:
+		{
+			PolicyBranchTypes eMyIdeology = kFromPlayer.GetPlayerPolicies()->GetLateGamePolicyTree();
+			PolicyBranchTypes eTheirIdeology = kToPlayer.GetPlayerPolicies()->GetLateGamePolicyTree();
+			if (eMyIdeology != NO_POLICY_BRANCH_TYPE && eTheirIdeology != NO_POLICY_BRANCH_TYPE && eMyIdeology != eTheirIdeology)
+			{
+				iMultiplier += GC.getTOURISM_MODIFIER_DIFFERENT_IDEOLOGIES();
+
+				if (kFromPlayer.GetEspionage()->IsMyDiplomatVisitingThem(eToPlayer))
+				{
+					iMultiplier += GC.getTOURISM_MODIFIER_DIPLOMAT();
+				}
+			}
+		}
+		break;
+	case TOURISM_MODIFIER_COMPONENT_POLICIES:
+		{
+			int iCommonFoeMod = kFromPlayer.GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_COMMON_FOE);
+			if (iCommonFoeMod > 0)
+			{
+				PlayerTypes eLoopPlayer;
+				for(int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+				{
+					eLoopPlayer = (PlayerTypes) iPlayerLoop;
+
+					if (eLoopPlayer != eToPlayer && eLoopPlayer != eFromPlayer && kFromPlayer.GetDiplomacyAI()->IsPlayerValid(eLoopPlayer))
+					{
+						// Are they at war with me too?
+						if (GET_TEAM(kFromPlayer.getTeam()).isAtWar(GET_PLAYER(eLoopPlayer).getTeam()) && GET_TEAM(kToPlayer.getTeam()).isAtWar(GET_PLAYER(eLoopPlayer).getTeam()))
+						{
+							iMultiplier += iCommonFoeMod;
+						}
+					}
+				}
+			}
+			int iSharedIdeologyMod = kFromPlayer.GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_SHARED_IDEOLOGY);
+			if (iSharedIdeologyMod > 0)
+			{
+				PolicyBranchTypes eMyIdeology = kFromPlayer.GetPlayerPolicies()->GetLateGamePolicyTree();
+				PolicyBranchTypes eTheirIdeology = kToPlayer.GetPlayerPolicies()->GetLateGamePolicyTree();
+				if (eMyIdeology != NO_POLICY_BRANCH_TYPE && eTheirIdeology != NO_POLICY_BRANCH_TYPE && eMyIdeology == eTheirIdeology)
+				{
+					iMultiplier += iSharedIdeologyMod;
+				}
+			}
+		}
+		break;
+	default:
+		CvAssertMsg(false, "Invalid tourism modifier component");
+		break;
+	}
+
+	return iMultiplier;
+}
+
+/// Marks the game's tourism modifier matrix as stale (safe to call before the game's culture object exists)
+void CvGameCulture::DirtyTourismModifierMatrix()
+{
+	CvGameCulture* pGameCulture = GC.getGame().GetGameCulture();
+	if (pGameCulture)
+	{
+		pGameCulture->SetTourismModifierMatrixDirty();
+	}
+}
+
+/// Recomputes every player-to-player tourism modifier component; per-player data is gathered once instead of once per pair
+void CvGameCulture::RebuildTourismModifierMatrix() const
+{
+	bool abAlive[MAX_MAJOR_CIVS];
+	ReligionTypes aeMajorityReligion[MAX_MAJOR_CIVS];
+	PolicyBranchTypes aeIdeology[MAX_MAJOR_CIVS];
+	bool aabTradeConnected[MAX_MAJOR_CIVS][MAX_MAJOR_CIVS];
+	int iFromLoop, iToLoop;
+
+	for (iFromLoop = 0; iFromLoop < MAX_MAJOR_CIVS; iFromLoop++)
+	{
+		CvPlayer &kPlayer = GET_PLAYER((PlayerTypes)iFromLoop);
+		abAlive[iFromLoop] = kPlayer.isAlive();
+		aeMajorityReligion[iFromLoop] = NO_RELIGION;
+		aeIdeology[iFromLoop] = NO_POLICY_BRANCH_TYPE;
+		if (abAlive[iFromLoop])
+		{
+			// Only one religion can have a strict majority, so comparing majority religions is the same as HasReligionInMostCities()
+			aeMajorityReligion[iFromLoop] = kPlayer.GetReligions()->GetReligionInMostCities();
+			aeIdeology[iFromLoop] = kPlayer.GetPlayerPolicies()->GetLateGamePolicyTree();
+		}
+	}
+
+	// Single pass over all trade routes instead of one pass per player pair
+	memset(aabTradeConnected, 0, sizeof(aabTradeConnected));
+	CvGameTrade* pGameTrade = GC.getGame().GetGameTrade();
+	for (uint ui = 0; ui < pGameTrade->m_aTradeConnections.size(); ui++)
+	{
+		if (pGameTrade->IsTradeRouteIndexEmpty(ui))
+		{
+			continue;
+		}
+
+		const TradeConnection& kConnection = pGameTrade->m_aTradeConnections[ui];
+		if (kConnection.m_eOriginOwner >= 0 && kConnection.m_eOriginOwner < MAX_MAJOR_CIVS && kConnection.m_eDestOwner >= 0 && kConnection.m_eDestOwner < MAX_MAJOR_CIVS)
+		{
+			aabTradeConnected[kConnection.m_eOriginOwner][kConnection.m_eDestOwner] = true;
+			aabTradeConnected[kConnection.m_eDestOwner][kConnection.m_eOriginOwner] = true;
+		}
+	}
+
+	for (iFromLoop = 0; iFromLoop < MAX_MAJOR_CIVS; iFromLoop++)
+	{
+		PlayerTypes eFromPlayer = (PlayerTypes)iFromLoop;
+		CvPlayer &kFromPlayer = GET_PLAYER(eFromPlayer);
+		CvPlayerCulture* pFromCulture = kFromPlayer.GetCulture();
+		bool bFromValid = abAlive[iFromLoop];
+
+		int iSharedReligionMod = 0;
+		int iOpenBordersMod = 0;
+		int iTradeRouteMod = 0;
+		int iCommonFoeMod = 0;
+		int iSharedIdeologyMod = 0;
+		if (bFromValid)
+		{
+			iSharedReligionMod = pFromCulture->GetTourismModifierSharedReligion();
+			iOpenBordersMod = pFromCulture->GetTourismModifierOpenBorders();
+			iTradeRouteMod = pFromCulture->GetTourismModifierTradeRoute();
+			iCommonFoeMod = kFromPlayer.GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_COMMON_FOE);
+			iSharedIdeologyMod = kFromPlayer.GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_SHARED_IDEOLOGY);
+		}
+
+		for (iToLoop = 0; iToLoop < MAX_MAJOR_CIVS; iToLoop++)
+		{
+			PlayerTypes eToPlayer = (PlayerTypes)iToLoop;
+			int* piEntry = m_aaaiTourismModifiers[iFromLoop][iToLoop];
+			for (int iComponent = 0; iComponent < NUM_TOURISM_MODIFIER_COMPONENTS; iComponent++)
+			{
+				piEntry[iComponent] = 0;
+			}
+
+			if (!bFromValid || !abAlive[iToLoop])
+			{
+				continue;
+			}
+
+			CvPlayer &kToPlayer = GET_PLAYER(eToPlayer);
+
+			if (aeMajorityReligion[iFromLoop] != NO_RELIGION && aeMajorityReligion[iToLoop] == aeMajorityReligion[iFromLoop])
+			{
+				piEntry[TOURISM_MODIFIER_COMPONENT_SHARED_RELIGION] += iSharedReligionMod;
+			}
+
+			if (GET_TEAM(kToPlayer.getTeam()).IsAllowsOpenBordersToTeam(kFromPlayer.getTeam()))
+			{
+				piEntry[TOURISM_MODIFIER_COMPONENT_OPEN_BORDERS] += iOpenBordersMod;
+			}
+
+			if (aabTradeConnected[iFromLoop][iToLoop])
+			{
+				piEntry[TOURISM_MODIFIER_COMPONENT_TRADE_ROUTE] += iTradeRouteMod;
+			}
+
+			if (aeIdeology[iFromLoop] != NO_POLICY_BRANCH_TYPE && aeIdeology[iToLoop] != NO_POLICY_BRANCH_TYPE)
+			{
+				if (aeIdeology[iFromLoop] != aeIdeology[iToLoop])
+				{
+					piEntry[TOURISM_MODIFIER_COMPONENT_IDEOLOGIES] += GC.getTOURISM_MODIFIER_DIFFERENT_IDEOLOGIES();
+
+					if (kFromPlayer.GetEspionage()->IsMyDiplomatVisitingThem(eToPlayer))
+					{
+						piEntry[TOURISM_MODIFIER_COMPONENT_IDEOLOGIES] += GC.getTOURISM_MODIFIER_DIPLOMAT();
+					}
+				}
+				else if (iSharedIdeologyMod > 0)
+				{
+					piEntry[TOURISM_MODIFIER_COMPONENT_POLICIES] += iSharedIdeologyMod;
+				}
+			}
+
+			if (iCommonFoeMod > 0)
+			{
+				for (int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+				{
+					PlayerTypes eLoopPlayer = (PlayerTypes) iPlayerLoop;
+
+					if (eLoopPlayer != eToPlayer && eLoopPlayer != eFromPlayer && kFromPlayer.GetDiplomacyAI()->IsPlayerValid(eLoopPlayer))
+					{
+						// Are they at war with me too?
+						if (GET_TEAM(kFromPlayer.getTeam()).isAtWar(GET_PLAYER(eLoopPlayer).getTeam()) && GET_TEAM(kToPlayer.getTeam()).isAtWar(GET_PLAYER(eLoopPlayer).getTeam()))
+						{
+							piEntry[TOURISM_MODIFIER_COMPONENT_POLICIES] += iCommonFoeMod;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	m_iTourismModifierMatrixTurn = GC.getGame().getGameTurn();
+	m_bTourismModifierMatrixDirty = false;
+}
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+
 // SERIALIZATION
 
 /// Serialization read
@@ -653,6 +912,10 @@ FDataStream& operator>>(FDataStream& loadFrom, CvGameCulture& writeTo)
 		writeTo.SetReportedSomeoneInfluential(false);
 	}
 
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	writeTo.SetTourismModifierMatrixDirty();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+
 	return loadFrom;
 }
 
@@ -2388,6 +2651,12 @@ int CvPlayerCulture::GetInfluencePerTurn(PlayerTypes ePlayer) const
 
 		// only check for firewall if the internet influence spread modifier is > 0
 		int iTechSpreadModifier = m_pPlayer->GetInfluenceSpreadModifier();
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+		if (iTechSpreadModifier > 0)
+		{
+			bTargetHasGreatFirewall = kOtherPlayer.HasBuildingWithFlag(BUILDING_FLAG_NULLIFY_INFLUENCE_MODIFIER);
+		}
+#else
 		if (iTechSpreadModifier > 0) 
 		{
 			for (pLoopCity = GET_PLAYER(ePlayer).firstCity(&iLoopCity); pLoopCity != NULL; pLoopCity = GET_PLAYER(ePlayer).nextCity(&iLoopCity))
@@ -2422,6 +2691,7 @@ int CvPlayerCulture::GetInfluencePerTurn(PlayerTypes ePlayer) const
 				}
 			}
 		}
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 
 		// Loop through each of our cities
 		for (pLoopCity = m_pPlayer->firstCity(&iLoopCity); pLoopCity != NULL; pLoopCity = m_pPlayer->nextCity(&iLoopCity))
@@ -2832,6 +3102,32 @@ int CvPlayerCulture::GetTourism()
 /// At the player level, what is the modifier for tourism between these players?
 int CvPlayerCulture::GetTourismModifierWith(PlayerTypes ePlayer) const
 {
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	int iMultiplier = 0;
+	CvPlayer &kPlayer = GET_PLAYER(ePlayer);
+	const CvGameCulture* pGameCulture = GC.getGame().GetGameCulture();
+	for (int iComponent = 0; iComponent < NUM_TOURISM_MODIFIER_COMPONENTS; iComponent++)
+	{
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pPlayer->GetID(), ePlayer, (TourismModifierComponentTypes)iComponent);
+	}
+
+	// Happiness changes too often to be cached
+	int iLessHappyMod = m_pPlayer->GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_LESS_HAPPY);
+	if (iLessHappyMod > 0)
+	{
+		if (m_pPlayer->GetExcessHappiness() > kPlayer.GetExcessHappiness())
+		{
+			iMultiplier += iLessHappyMod;
+		}
+	}
+
+	if (m_pPlayer->isGoldenAge() && m_pPlayer->GetPlayerTraits()->GetGoldenAgeTourismModifier())
+	{
+		iMultiplier += m_pPlayer->GetPlayerTraits()->GetGoldenAgeTourismModifier();
+	}
+
+	return iMultiplier;
+#else
 	int iMultiplier = 0;
 	CvPlayer &kPlayer = GET_PLAYER(ePlayer);
 	CvTeam &kTeam = GET_TEAM(kPlayer.getTeam());
@@ -2907,6 +3203,7 @@ int CvPlayerCulture::GetTourismModifierWith(PlayerTypes ePlayer) const
 	}
 
 	return iMultiplier;
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 }
 
 /// Tooltip for GetTourismModifierWith()
@@ -4288,6 +4585,44 @@ int CvCityCulture::GetBaseTourism()
 /// What is the tourism modifier for one player
 int CvCityCulture::GetTourismMultiplier(PlayerTypes ePlayer, bool bIgnoreReligion, bool bIgnoreOpenBorders, bool bIgnoreTrade, bool bIgnorePolicies, bool bIgnoreIdeologies) const
 {
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	int iMultiplier = 0;
+	CvPlayer &kPlayer = GET_PLAYER(ePlayer);
+	CvPlayer &kCityPlayer = GET_PLAYER(m_pCity->getOwner());
+	const CvGameCulture* pGameCulture = GC.getGame().GetGameCulture();
+
+	if (!bIgnoreReligion)
+	{
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pCity->getOwner(), ePlayer, TOURISM_MODIFIER_COMPONENT_SHARED_RELIGION);
+	}
+	if (!bIgnoreOpenBorders)
+	{
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pCity->getOwner(), ePlayer, TOURISM_MODIFIER_COMPONENT_OPEN_BORDERS);
+	}
+	if (!bIgnoreTrade)
+	{
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pCity->getOwner(), ePlayer, TOURISM_MODIFIER_COMPONENT_TRADE_ROUTE);
+	}
+	if (!bIgnoreIdeologies)
+	{
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pCity->getOwner(), ePlayer, TOURISM_MODIFIER_COMPONENT_IDEOLOGIES);
+	}
+	if (!bIgnorePolicies)
+	{
+		// Happiness changes too often to be cached
+		int iLessHappyMod = kCityPlayer.GetPlayerPolicies()->GetNumericModifier(POLICYMOD_TOURISM_MOD_LESS_HAPPY);
+		if (iLessHappyMod > 0)
+		{
+			if (kCityPlayer.GetExcessHappiness() > kPlayer.GetExcessHappiness())
+			{
+				iMultiplier += iLessHappyMod;
+			}
+		}
+		iMultiplier += pGameCulture->GetTourismModifierComponent(m_pCity->getOwner(), ePlayer, TOURISM_MODIFIER_COMPONENT_POLICIES);
+	}
+
+	return iMultiplier;
+#else
 	int iMultiplier = 0;
 	CvPlayer &kPlayer = GET_PLAYER(ePlayer);
 	CvTeam &kTeam = GET_TEAM(kPlayer.getTeam());
@@ -4377,6 +4712,7 @@ int CvCityCulture::GetTourismMultiplier(PlayerTypes ePlayer, bool bIgnoreReligio
 	// LATER add top science city and research agreement with this player???
 
 	return iMultiplier;
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 }
 
 /// What is the tooltip describing the tourism output?
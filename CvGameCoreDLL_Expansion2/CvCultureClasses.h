@@ -39,6 +39,19 @@ FDataStream& operator<<(FDataStream&, const CvGreatWork&);
 
 typedef FStaticVector<CvGreatWork, MAX_MAJOR_CIVS, false, c_eCiv5GameplayDLL > GreatWorkList;
 
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+// Player-to-player parts of the tourism modifier that are cached by CvGameCulture
+enum TourismModifierComponentTypes
+{
+	TOURISM_MODIFIER_COMPONENT_SHARED_RELIGION,
+	TOURISM_MODIFIER_COMPONENT_OPEN_BORDERS,
+	TOURISM_MODIFIER_COMPONENT_TRADE_ROUTE,
+	TOURISM_MODIFIER_COMPONENT_IDEOLOGIES,		// different ideologies, plus diplomat bonus
+	TOURISM_MODIFIER_COMPONENT_POLICIES,		// common foe and shared ideology (less happy is volatile, so it is always computed live)
+	NUM_TOURISM_MODIFIER_COMPONENTS
+};
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  CLASS:		CvGameCulture
 //!  \brief		All the information about culture at the game level
@@ -92,8 +105,27 @@ public:
 		m_bReportedSomeoneInfluential = bValue;
 	};
 
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	// Tourism modifier matrix
+	int GetTourismModifierComponent(PlayerTypes eFromPlayer, PlayerTypes eToPlayer, TourismModifierComponentTypes eComponent) const;
+	void SetTourismModifierMatrixDirty()
+	{
+		m_bTourismModifierMatrixDirty = true;
+	};
+	static void DirtyTourismModifierMatrix();
+	static int ComputeTourismModifierComponent(PlayerTypes eFromPlayer, PlayerTypes eToPlayer, TourismModifierComponentTypes eComponent);
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+
 private:
 	bool m_bReportedSomeoneInfluential;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	void RebuildTourismModifierMatrix() const;
+
+	// Not serialized, rebuilt on first access of each turn or after being dirtied
+	mutable int m_aaaiTourismModifiers[MAX_MAJOR_CIVS][MAX_MAJOR_CIVS][NUM_TOURISM_MODIFIER_COMPONENTS];
+	mutable int m_iTourismModifierMatrixTurn;
+	mutable bool m_bTourismModifierMatrixDirty;
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 };
 
 FDataStream& operator>>(FDataStream&, CvGameCulture&);
@@ -13,6 +13,9 @@
 #include "LintFree.h"
 
 CvDatabaseUtility::CvDatabaseUtility()
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	: m_bPrefetchChildTables(false)
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 {
 
 }
@@ -32,6 +35,10 @@ void CvDatabaseUtility::ClearResults()
 	}
 
 	m_storedResults.clear();
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	m_prefetchedChildTables.clear();
+	m_maxRows.clear();
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 }
 //------------------------------------------------------------------------------
 void CvDatabaseUtility::ClearResults(const std::string& strKey)
@@ -151,6 +158,24 @@ bool CvDatabaseUtility::PopulateArrayByExistence(bool*& pArray, const char* szTy
 	strKey.append(szDataTableName);
 	strKey.append(szFilterColumn);
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	if(m_bPrefetchChildTables)
+	{
+		const ChildTableRows* pRows = NULL;
+		if(!GetPrefetchedChildRows(strKey, szTypeTableName, szDataTableName, szTypeColumn, szFilterColumn, szFilterValue, NULL, pRows))
+			return false;
+
+		if(pRows)
+		{
+			for(ChildTableRows::const_iterator it = pRows->begin(); it != pRows->end(); ++it)
+			{
+				pArray[it->m_iTypeID] = true;
+			}
+		}
+		return true;
+	}
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+
 	Database::Results* pResults = GetResults(strKey);
 	if(pResults == NULL)
 	{
@@ -188,6 +213,25 @@ bool CvDatabaseUtility::PopulateArrayByExistence(int*& pArray, const char* szTyp
 	strKey.append(szDataTableName);
 	strKey.append(szFilterColumn);
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	if(m_bPrefetchChildTables)
+	{
+		const ChildTableRows* pRows = NULL;
+		if(!GetPrefetchedChildRows(strKey, szTypeTableName, szDataTableName, szTypeColumn, szFilterColumn, szFilterValue, NULL, pRows))
+			return false;
+
+		if(pRows)
+		{
+			int idx = 0;
+			for(ChildTableRows::const_iterator it = pRows->begin(); it != pRows->end(); ++it)
+			{
+				pArray[idx++] = it->m_iTypeID;
+			}
+		}
+		return true;
+	}
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+
 	Database::Results* pResults = GetResults(strKey);
 	if(pResults == NULL)
 	{
@@ -226,6 +270,24 @@ bool CvDatabaseUtility::PopulateArrayByValue(int*& pArray, const char* szTypeTab
 	strKey.append(szFilterColumn);
 	strKey.append(szValueColumn);
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	if(m_bPrefetchChildTables)
+	{
+		const ChildTableRows* pRows = NULL;
+		if(!GetPrefetchedChildRows(strKey, szTypeTableName, szDataTableName, szTypeColumn, szFilterColumn, szFilterValue, szValueColumn, pRows))
+			return false;
+
+		if(pRows)
+		{
+			for(ChildTableRows::const_iterator it = pRows->begin(); it != pRows->end(); ++it)
+			{
+				pArray[it->m_iTypeID] = it->m_iValue;
+			}
+		}
+		return true;
+	}
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+
 	Database::Results* pResults = GetResults(strKey);
 	if(pResults == NULL)
 	{
@@ -274,6 +336,16 @@ bool CvDatabaseUtility::SetYields(int*& pYieldsArray,
 //------------------------------------------------------------------------------
 int CvDatabaseUtility::MaxRows(const char* szTableName)
 {
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	if(m_bPrefetchChildTables)
+	{
+		stdext::hash_map<std::string, int>::const_iterator it = m_maxRows.find(szTableName);
+		if(it != m_maxRows.end())
+		{
+			return it->second;
+		}
+	}
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 	char szSQL[256] = {0};
 	sprintf_s(szSQL, "SELECT max(rowid) from %s", szTableName);
 	Database::Results kResults;
@@ -287,6 +359,12 @@ int CvDatabaseUtility::MaxRows(const char* szTableName)
 		}
 	}
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	if(m_bPrefetchChildTables)
+	{
+		m_maxRows[szTableName] = maxValue;
+	}
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 	return maxValue;
 }
 //------------------------------------------------------------------------------
@@ -294,4 +372,62 @@ const char* CvDatabaseUtility::GetErrorMessage() const
 {
 	return DB.ErrorMessage();
 }
-//------------------------------------------------------------------------------
\ No newline at end of file
+//------------------------------------------------------------------------------
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+void CvDatabaseUtility::SetPrefetchChildTables(bool bPrefetch)
+{
+	if(m_bPrefetchChildTables != bPrefetch)
+	{
+		m_bPrefetchChildTables = bPrefetch;
+		m_prefetchedChildTables.clear();
+		m_maxRows.clear();
+	}
+}
+//------------------------------------------------------------------------------
+bool CvDatabaseUtility::GetPrefetchedChildRows(const std::string& strKey, const char* szTypeTableName, const char* szDataTableName, const char* szTypeColumn,
+                                               const char* szFilterColumn, const char* szFilterValue, const char* szValueColumn, const ChildTableRows*& pRows)
+{
+	pRows = NULL;
+
+	ChildTableMap::iterator itTable = m_prefetchedChildTables.find(strKey);
+	if(itTable == m_prefetchedChildTables.end())
+	{
+		// Read the whole child table once, grouped by the parent it belongs to (rows keep their relative order within each parent)
+		char szSQL[512];
+		if(szValueColumn)
+			sprintf_s(szSQL, "select %s.ID, %s, %s from %s inner join %s on %s = %s.Type", szTypeTableName, szFilterColumn, szValueColumn, szDataTableName, szTypeTableName, szTypeColumn, szTypeTableName);
+		else
+			sprintf_s(szSQL, "select %s.ID, %s from %s inner join %s on %s = %s.Type", szTypeTableName, szFilterColumn, szDataTableName, szTypeTableName, szTypeColumn, szTypeTableName);
+
+		Database::Results kResults;
+		if(!DB.Execute(kResults, szSQL))
+		{
+			CvAssertMsg(false, GetErrorMessage());
+			return false;
+		}
+
+		itTable = m_prefetchedChildTables.insert(ChildTableMap::value_type(strKey, ChildTableRowsByParent())).first;
+		ChildTableRowsByParent& kRowsByParent = itTable->second;
+		while(kResults.Step())
+		{
+			const char* szParent = kResults.GetText(1);
+			if(szParent == NULL)
+				continue;
+
+			ChildTableRow kRow;
+			kRow.m_iTypeID = kResults.GetInt(0);
+			kRow.m_iValue = szValueColumn ? kResults.GetInt(2) : 0;
+			kRowsByParent[szParent].push_back(kRow);
+		}
+	}
+
+	ChildTableRowsByParent::const_iterator itRows = itTable->second.find(szFilterValue);
+	if(itRows != itTable->second.end())
+	{
+		pRows = &itRows->second;
+	}
+
+	return true;
+}
+//------------------------------------------------------------------------------
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
\ No newline at end of file
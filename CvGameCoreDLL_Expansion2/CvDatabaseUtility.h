@@ -99,9 +99,32 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 	//! Returns the most recent database error message.
 	const char* GetErrorMessage() const;
 
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	//! When enabled, PopulateArrayBy...() reads each child table once (instead of once per parent row) and MaxRows() is cached.
+	//! Only enable this for utilities that load a whole table of parents while the database does not change.
+	void SetPrefetchChildTables(bool bPrefetch);
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+
 private:
 	typedef stdext::hash_map<std::string, Database::Results*> ResultsMap;
 	ResultsMap m_storedResults;
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	struct ChildTableRow
+	{
+		int m_iTypeID;
+		int m_iValue;
+	};
+	typedef std::vector<ChildTableRow> ChildTableRows;
+	typedef stdext::hash_map<std::string, ChildTableRows> ChildTableRowsByParent;
+	typedef stdext::hash_map<std::string, ChildTableRowsByParent> ChildTableMap;
+
+	bool GetPrefetchedChildRows(const std::string& strKey, const char* szTypeTableName, const char* szDataTableName, const char* szTypeColumn,
+	                            const char* szFilterColumn, const char* szFilterValue, const char* szValueColumn, const ChildTableRows*& pRows);
+
+	bool m_bPrefetchChildTables;
+	ChildTableMap m_prefetchedChildTables;
+	stdext::hash_map<std::string, int> m_maxRows;
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 };
 
 //------------------------------------------------------------------------------
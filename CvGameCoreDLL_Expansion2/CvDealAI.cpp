@@ -19,6 +19,25 @@
 // must be included after all other headers
 #include "LintFree.h"
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+/// Keeps a DealAI's trade item value memo open for as long as this object is in scope
+class CvDealAIItemValueMemoScope
+{
+public:
+	CvDealAIItemValueMemoScope(CvDealAI* pDealAI) : m_pDealAI(pDealAI)
+	{
+		m_pDealAI->OpenItemValueMemo();
+	}
+	~CvDealAIItemValueMemoScope()
+	{
+		m_pDealAI->CloseItemValueMemo();
+	}
+
+private:
+	CvDealAI* m_pDealAI;
+};
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
+
 //======================================================================================================
 //					CvDealAI
 //======================================================================================================
@@ -49,6 +68,10 @@ void CvDealAI::Uninit()
 void CvDealAI::Reset()
 {
 	m_iCachedValueOfPeaceWithHuman = 0;
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	m_aiItemValueMemo.clear();
+	m_iItemValueMemoDepth = 0;
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
 }
 
 /// Serialization read
@@ -579,6 +602,9 @@ bool CvDealAI::DoEqualizeDealWithHuman(CvDeal* pDeal, PlayerTypes eOtherPlayer,
 
 	int iDealDuration = GC.getGame().GetDealDuration();
 	bCantMatchOffer = false;
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	CvDealAIItemValueMemoScope kItemValueMemo(this);
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
 
 	// Is this a peace deal?
 	if (pDeal->IsPeaceTreatyTrade(eOtherPlayer))
@@ -671,6 +697,9 @@ bool CvDealAI::DoEqualizeDealWithAI(CvDeal* pDeal, PlayerTypes eOtherPlayer)
 	CvAssert(eOtherPlayer < MAX_MAJOR_CIVS);
 	CvAssertMsg(eMyPlayer != eOtherPlayer, "DEAL_AI: Trying to equalize AI deal, but both players are the same.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	CvDealAIItemValueMemoScope kItemValueMemo(this);
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
 	int iEvenValueImOffering;
 	int iEvenValueTheyreOffering;
 	int iTotalValue = GetDealValue(pDeal, iEvenValueImOffering, iEvenValueTheyreOffering, /*bUseEvenValue*/ true);
@@ -835,6 +864,26 @@ int CvDealAI::GetTradeItemValue(TradeableItems eItem, bool bFromMe, PlayerTypes
 	CvAssertMsg(GetPlayer()->GetID() != eOtherPlayer, "DEAL_AI: Trying to get deal item value for trading to oneself.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 	CvAssertMsg(eItem != TRADE_ITEM_NONE, "DEAL_AI: Trying to get value of TRADE_ITEM_NONE.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	CvTradeItemValueKey kKey;
+	if(m_iItemValueMemoDepth > 0)
+	{
+		kKey.m_eItem = eItem;
+		kKey.m_eOtherPlayer = eOtherPlayer;
+		kKey.m_iData1 = iData1;
+		kKey.m_iData2 = iData2;
+		kKey.m_iData3 = iData3;
+		kKey.m_iDuration = iDuration;
+		kKey.m_bFromMe = bFromMe;
+		kKey.m_bFlag1 = bFlag1;
+		kKey.m_bUseEvenValue = bUseEvenValue;
+
+		std::map<CvTradeItemValueKey, int>::const_iterator it = m_aiItemValueMemo.find(kKey);
+		if(it != m_aiItemValueMemo.end())
+			return it->second;
+	}
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
+
 	int iItemValue = 0;
 
 	if(eItem == TRADE_ITEM_GOLD)
@@ -866,9 +915,57 @@ int CvDealAI::GetTradeItemValue(TradeableItems eItem, bool bFromMe, PlayerTypes
 
 	CvAssertMsg(iItemValue >= 0, "DEAL_AI: Trade Item value is negative.  Please send Jon this with your last 5 autosaves and what changelist # you're playing.");
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	if(m_iItemValueMemoDepth > 0)
+	{
+		m_aiItemValueMemo[kKey] = iItemValue;
+	}
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
+
 	return iItemValue;
 }
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+/// Ordering for the item value memo, cheapest and most discriminating fields first
+bool CvDealAI::CvTradeItemValueKey::operator<(const CvTradeItemValueKey& rhs) const
+{
+	if(m_eItem != rhs.m_eItem)
+		return m_eItem < rhs.m_eItem;
+	if(m_bFromMe != rhs.m_bFromMe)
+		return rhs.m_bFromMe;
+	if(m_iData1 != rhs.m_iData1)
+		return m_iData1 < rhs.m_iData1;
+	if(m_iData2 != rhs.m_iData2)
+		return m_iData2 < rhs.m_iData2;
+	if(m_iData3 != rhs.m_iData3)
+		return m_iData3 < rhs.m_iData3;
+	if(m_iDuration != rhs.m_iDuration)
+		return m_iDuration < rhs.m_iDuration;
+	if(m_eOtherPlayer != rhs.m_eOtherPlayer)
+		return m_eOtherPlayer < rhs.m_eOtherPlayer;
+	if(m_bFlag1 != rhs.m_bFlag1)
+		return rhs.m_bFlag1;
+	return !m_bUseEvenValue && rhs.m_bUseEvenValue;
+}
+
+/// Starts memoizing trade item values, nests so that only the outermost close throws the memo away
+void CvDealAI::OpenItemValueMemo()
+{
+	m_iItemValueMemoDepth++;
+}
+
+/// Stops memoizing trade item values once every open memo has been closed
+void CvDealAI::CloseItemValueMemo()
+{
+	CvAssertMsg(m_iItemValueMemoDepth > 0, "DEAL_AI: Closing an item value memo that was never opened");
+	if(--m_iItemValueMemoDepth <= 0)
+	{
+		m_iItemValueMemoDepth = 0;
+		m_aiItemValueMemo.clear();
+	}
+}
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
+
 /// How much Gold should be provided if we're trying to make it worth iValue?
 int CvDealAI::GetGoldForForValueExchange(int iGoldOrValue, bool bNumGoldFromValue, bool bFromMe, PlayerTypes eOtherPlayer, bool bUseEvenValue, bool bRoundUp)
 {
@@ -77,6 +77,12 @@ public:
 	int GetThirdPartyWarValue(bool bFromMe, PlayerTypes eOtherPlayer, TeamTypes eWithTeam);
 	int GetVoteCommitmentValue(bool bFromMe, PlayerTypes eOtherPlayer, int iProposalID, int iVoteChoice, int iNumVotes, bool bRepeal, bool bUseEvenValue);
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	// Trade item values are memoized while at least one memo is open; nothing done while negotiating changes the game state they depend on
+	void OpenItemValueMemo();
+	void CloseItemValueMemo();
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
+
 	// Potential items an AI can try to add to a deal to even it out - bUseEvenValue will see what the mean is between two AI players (us and eOtherPlayer) - will NOT work with a human involved
 
 	void DoAddVoteCommitmentToThem(CvDeal* pDeal, PlayerTypes eThem, bool bDontChangeTheirExistingItems, int& iTotalValue, int& iValueImOffering, int& iValueTheyreOffering, int iAmountOverWeWillRequest, bool bUseEvenValue);
@@ -131,6 +137,24 @@ private:
 
 	int m_iCachedValueOfPeaceWithHuman;		// NOT SERIALIZED
 
+#ifdef AUI_DEALAI_ITEM_VALUE_MEMO
+	struct CvTradeItemValueKey
+	{
+		TradeableItems m_eItem;
+		PlayerTypes m_eOtherPlayer;
+		int m_iData1;
+		int m_iData2;
+		int m_iData3;
+		int m_iDuration;
+		bool m_bFromMe;
+		bool m_bFlag1;
+		bool m_bUseEvenValue;
+
+		bool operator<(const CvTradeItemValueKey& rhs) const;
+	};
+	std::map<CvTradeItemValueKey, int> m_aiItemValueMemo;	// NOT SERIALIZED
+	int m_iItemValueMemoDepth;								// NOT SERIALIZED
+#endif // AUI_DEALAI_ITEM_VALUE_MEMO
 };
 
 #endif //CIV5_DEALAI_H
\ No newline at end of file
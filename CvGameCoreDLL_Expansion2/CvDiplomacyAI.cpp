@@ -349,6 +349,9 @@ CvDiplomacyAI::CvDiplomacyAI():
 	m_eTestStatement(NO_DIPLO_STATEMENT_TYPE),
 	m_iTestStatementArg1(-1)
 {
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	m_bTurnFactsValid = false;
+#endif // AUI_DIPLOMACY_TURN_FACTS
 }
 
 /// Destructor
@@ -1962,6 +1965,9 @@ int CvDiplomacyAI::GetRandomPersonalityWeight(int iOriginalValue) const
 void CvDiplomacyAI::DoTurn(PlayerTypes eTargetPlayer)
 {
 	m_eTargetPlayer = eTargetPlayer;
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	DoBuildTurnFacts();
+#endif // AUI_DIPLOMACY_TURN_FACTS
 	// Military Stuff
 	DoWarDamageDecay();
 	DoUpdateWarDamageLevel();
@@ -2006,6 +2012,11 @@ void CvDiplomacyAI::DoTurn(PlayerTypes eTargetPlayer)
 	DoUpdateMajorCivApproaches();
 	DoUpdateMinorCivApproaches();
 
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	// Everything below can declare war, make peace, or trade, so the facts gathered for evaluation are no longer trustworthy
+	m_bTurnFactsValid = false;
+
+#endif // AUI_DIPLOMACY_TURN_FACTS
 	// These functions actually DO things, and we don't want the shadow AI behind a human player doing things for him
 	if(!GetPlayer()->isHuman())
 	{
@@ -2563,7 +2574,11 @@ void CvDiplomacyAI::DoEstimateOtherPlayerOpinions()
 				if(eLoopPlayer != eLoopOtherPlayer)
 				{
 					// Do both we and the guy we're looking about know the third guy?
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+					if(IsPlayerValidToUsAndPlayer(eLoopPlayer, eLoopOtherPlayer, true))
+#else
 					if(IsPlayerValid(eLoopOtherPlayer, true) && GET_PLAYER(eLoopPlayer).GetDiplomacyAI()->IsPlayerValid(eLoopOtherPlayer))
+#endif // AUI_DIPLOMACY_TURN_FACTS
 					{
 						iOpinionWeight = 0;
 
@@ -6617,11 +6632,15 @@ void CvDiplomacyAI::DoUpdateOnePlayerTargetValue(PlayerTypes ePlayer)
 
 	int iWarCount;
 
+#ifndef AUI_DIPLOMACY_TURN_FACTS
 	CvCity* pLoopCity;
 	int iCityLoop;
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 	int iOtherPlayerMilitaryStrength;
+#ifndef AUI_DIPLOMACY_TURN_FACTS
 	int iCityStrengthMod;
+#endif // AUI_DIPLOMACY_TURN_FACTS
 	int iMilitaryRatio;
 
 	int iMyMilitaryStrength = GetPlayer()->getPower();
@@ -6647,6 +6666,10 @@ void CvDiplomacyAI::DoUpdateOnePlayerTargetValue(PlayerTypes ePlayer)
 	iOtherPlayerMilitaryStrength = GET_PLAYER(ePlayer).getPower();
 
 	// City Defensive Strength
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	// Also keeps track of damage because we'll use it later as a global modifier for the player's strength
+	iOtherPlayerMilitaryStrength += GetPlayerCityTargetStrength(ePlayer, iCityDamage, iNumCities);
+#else
 	for(pLoopCity = GET_PLAYER(ePlayer).firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(ePlayer).nextCity(&iCityLoop))
 	{
 		iCityStrengthMod = pLoopCity->GetPower();
@@ -6660,6 +6683,7 @@ void CvDiplomacyAI::DoUpdateOnePlayerTargetValue(PlayerTypes ePlayer)
 		iCityDamage += pLoopCity->getDamage();
 		iNumCities++;
 	}
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 	// Depending on how damaged a player's Cities are, he can become a much more attractive target
 	if(iNumCities > 0)
@@ -6680,7 +6704,11 @@ void CvDiplomacyAI::DoUpdateOnePlayerTargetValue(PlayerTypes ePlayer)
 	iTargetValue += iMilitaryRatio;
 
 	// Increase target value if the player is already at war with other players
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	iWarCount = GetPlayerTeamAtWarCount(ePlayer);
+#else
 	iWarCount = GET_TEAM(GET_PLAYER(ePlayer).getTeam()).getAtWarCount(true);
+#endif // AUI_DIPLOMACY_TURN_FACTS
 	// Reduce by 1 if WE'RE already at war with him
 	if(GET_TEAM(GetTeam()).isAtWar(GET_PLAYER(ePlayer).getTeam()))
 	{
@@ -6831,6 +6859,9 @@ void CvDiplomacyAI::DoUpdateMilitaryThreats()
 	}
 
 	// Add in City Defensive Strength
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	iMyMilitaryStrength += GetPlayerCityDefenseStrength(GetPlayer()->GetID());
+#else
 	CvCity* pLoopCity;
 	int iCityLoop;
 	int iCityStrengthMod;
@@ -6844,6 +6875,7 @@ void CvDiplomacyAI::DoUpdateMilitaryThreats()
 		iCityStrengthMod /= 100;
 		iMyMilitaryStrength += iCityStrengthMod;
 	}
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 	int iOtherPlayerMilitaryStrength;
 	int iMilitaryRatio;
@@ -6923,7 +6955,11 @@ void CvDiplomacyAI::DoUpdateMilitaryThreats()
 				iMilitaryThreat += (GetOtherPlayerNumMajorsConquered(eLoopPlayer) * /*20*/ GC.getMILITARY_THREAT_PER_MAJOR_CONQUERED());
 
 				// Reduce the Threat (dramatically) if the player is already at war with other players
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+				iWarCount = GetPlayerTeamAtWarCount(eLoopPlayer);
+#else
 				iWarCount = GET_TEAM(GET_PLAYER(eLoopPlayer).getTeam()).getAtWarCount(true);
+#endif // AUI_DIPLOMACY_TURN_FACTS
 				if(iWarCount > 0)
 				{
 					iMilitaryThreat += (/*-30*/ GC.getMILITARY_THREAT_ALREADY_WAR_EACH_PLAYER_MULTIPLIER() * iWarCount * iMilitaryThreat / 100);
@@ -6980,9 +7016,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 
 	int iPlayerMilitaryStrength;
 
+#ifndef AUI_DIPLOMACY_TURN_FACTS
 	CvCity* pLoopCity;
 	int iCityLoop;
 	int iCityStrengthMod;
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 	int iThirdPlayerMilitaryStrength;
 	int iMilitaryRatio;
@@ -7001,6 +7039,9 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 			iPlayerMilitaryStrength = GET_PLAYER(eLoopPlayer).GetMilitaryMight();
 
 			// Add in City Defensive Strength
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+			iPlayerMilitaryStrength += GetPlayerCityDefenseStrength(eLoopPlayer);
+#else
 			for(pLoopCity = GET_PLAYER(eLoopPlayer).firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(eLoopPlayer).nextCity(&iCityLoop))
 			{
 				iCityStrengthMod = pLoopCity->GetPower();
@@ -7011,6 +7052,7 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 				iCityStrengthMod /= 100;
 				iPlayerMilitaryStrength += (MAX(iCityStrengthMod, 0));
 			}
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 			// Prevent divide by 0
 			if(iPlayerMilitaryStrength == 0)
@@ -7025,7 +7067,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 				if(eLoopPlayer != eLoopOtherPlayer)
 				{
 					// Do both we and the guy we're looking about know the third guy?
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+					if(IsPlayerValidToUsAndPlayer(eLoopPlayer, eLoopOtherPlayer))
+#else
 					if(IsPlayerValid(eLoopOtherPlayer) && GET_PLAYER(eLoopPlayer).GetDiplomacyAI()->IsPlayerValid(eLoopOtherPlayer))
+#endif // AUI_DIPLOMACY_TURN_FACTS
 					{
 						eMilitaryThreatType = THREAT_NONE;
 						iMilitaryThreat = 0;
@@ -7095,7 +7141,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 							iMilitaryThreat += (GetOtherPlayerNumMajorsConquered(eLoopOtherPlayer) * /*20*/ GC.getMILITARY_THREAT_PER_MAJOR_CONQUERED());
 
 							// Reduce the Threat (dramatically) if the player is already at war with other players
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+							iWarCount = GetPlayerTeamAtWarCount(eLoopOtherPlayer);
+#else
 							iWarCount = GET_TEAM(GET_PLAYER(eLoopOtherPlayer).getTeam()).getAtWarCount(true);
+#endif // AUI_DIPLOMACY_TURN_FACTS
 							if(iWarCount > 0)
 								iMilitaryThreat += (/*-30*/ GC.getMILITARY_THREAT_ALREADY_WAR_EACH_PLAYER_MULTIPLIER() * iWarCount * iMilitaryThreat / 100);
 						}
@@ -8163,7 +8213,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerLandDisputeLevels()
 				if(eLoopPlayer != eLoopOtherPlayer)
 				{
 					// Do both we and the guy we're looking about know the third guy?
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+					if(IsPlayerValidToUsAndPlayer(eLoopPlayer, eLoopOtherPlayer))
+#else
 					if(IsPlayerValid(eLoopOtherPlayer) && GET_PLAYER(eLoopPlayer).GetDiplomacyAI()->IsPlayerValid(eLoopOtherPlayer))
+#endif // AUI_DIPLOMACY_TURN_FACTS
 					{
 						eDisputeLevel = DISPUTE_LEVEL_NONE;
 						iLandDisputeWeight = 0;
@@ -8594,7 +8648,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerVictoryDisputeLevels()
 				if(eLoopPlayer != eLoopOtherPlayer)
 				{
 					// Do both we and the guy we're looking about know the third guy?
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+					if(IsPlayerValidToUsAndPlayer(eLoopPlayer, eLoopOtherPlayer))
+#else
 					if(IsPlayerValid(eLoopOtherPlayer) && GET_PLAYER(eLoopPlayer).GetDiplomacyAI()->IsPlayerValid(eLoopOtherPlayer))
+#endif // AUI_DIPLOMACY_TURN_FACTS
 					{
 						eDisputeLevel = DISPUTE_LEVEL_NONE;
 						iVictoryDisputeWeight = 0;
@@ -9076,7 +9134,11 @@ void CvDiplomacyAI::DoUpdateOtherPlayerWarDamageLevel()
 				if(eLoopPlayer != eLoopOtherPlayer)
 				{
 					// Do both we and the guy we're looking about know the third guy?
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+					if(IsPlayerValidToUsAndPlayer(eLoopPlayer, eLoopOtherPlayer))
+#else
 					if(IsPlayerValid(eLoopOtherPlayer) && GET_PLAYER(eLoopPlayer).GetDiplomacyAI()->IsPlayerValid(eLoopOtherPlayer))
+#endif // AUI_DIPLOMACY_TURN_FACTS
 					{
 						// At War?
 						if(GET_TEAM(GET_PLAYER(eLoopPlayer).getTeam()).isAtWar(GET_PLAYER(eLoopOtherPlayer).getTeam()))
@@ -22434,6 +22496,122 @@ bool CvDiplomacyAI::IsPlayerValid(PlayerTypes eOtherPlayer, bool bMyTeamIsValid)
 	return true;
 }
 
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+/// Gathers the facts about all players that DoTurn's evaluation passes would otherwise requery for every player pair
+void CvDiplomacyAI::DoBuildTurnFacts()
+{
+	int iI, iJ;
+	for(iI = 0; iI < MAX_MAJOR_CIVS; iI++)
+	{
+		PlayerTypes ePlayer = (PlayerTypes) iI;
+		m_abTurnFactPlayerValid[iI] = IsPlayerValid(ePlayer);
+		m_abTurnFactPlayerValidWithTeam[iI] = IsPlayerValid(ePlayer, /*bMyTeamIsValid*/ true);
+
+		CvDiplomacyAI* pOtherDiplomacyAI = GET_PLAYER(ePlayer).isAlive() ? GET_PLAYER(ePlayer).GetDiplomacyAI() : NULL;
+		for(iJ = 0; iJ < MAX_MAJOR_CIVS; iJ++)
+		{
+			m_aabTurnFactPlayerKnowsPlayer[iI][iJ] = (pOtherDiplomacyAI != NULL && iI != iJ && pOtherDiplomacyAI->IsPlayerValid((PlayerTypes) iJ));
+		}
+	}
+
+	// Turn facts are not valid yet, so these compute live
+	m_bTurnFactsValid = false;
+	for(iI = 0; iI < MAX_CIV_PLAYERS; iI++)
+	{
+		PlayerTypes ePlayer = (PlayerTypes) iI;
+		if(GET_PLAYER(ePlayer).isAlive())
+		{
+			m_aiTurnFactTeamAtWarCount[iI] = GetPlayerTeamAtWarCount(ePlayer);
+			m_aiTurnFactCityDefenseStrength[iI] = GetPlayerCityDefenseStrength(ePlayer);
+			m_aiTurnFactCityTargetStrength[iI] = GetPlayerCityTargetStrength(ePlayer, m_aiTurnFactTotalCityDamage[iI], m_aiTurnFactNumCities[iI]);
+		}
+		else
+		{
+			m_aiTurnFactTeamAtWarCount[iI] = 0;
+			m_aiTurnFactCityDefenseStrength[iI] = 0;
+			m_aiTurnFactCityTargetStrength[iI] = 0;
+			m_aiTurnFactTotalCityDamage[iI] = 0;
+			m_aiTurnFactNumCities[iI] = 0;
+		}
+	}
+	m_bTurnFactsValid = true;
+}
+
+/// Do both we and ePlayer know eOtherPlayer?
+bool CvDiplomacyAI::IsPlayerValidToUsAndPlayer(PlayerTypes ePlayer, PlayerTypes eOtherPlayer, bool bMyTeamIsValid)
+{
+	if(m_bTurnFactsValid && ePlayer < MAX_MAJOR_CIVS && eOtherPlayer < MAX_MAJOR_CIVS)
+	{
+		if(!(bMyTeamIsValid ? m_abTurnFactPlayerValidWithTeam[eOtherPlayer] : m_abTurnFactPlayerValid[eOtherPlayer]))
+			return false;
+		return m_aabTurnFactPlayerKnowsPlayer[ePlayer][eOtherPlayer];
+	}
+
+	return IsPlayerValid(eOtherPlayer, bMyTeamIsValid) && GET_PLAYER(ePlayer).GetDiplomacyAI()->IsPlayerValid(eOtherPlayer);
+}
+
+/// How many major civs is ePlayer's team at war with?
+int CvDiplomacyAI::GetPlayerTeamAtWarCount(PlayerTypes ePlayer) const
+{
+	if(m_bTurnFactsValid)
+		return m_aiTurnFactTeamAtWarCount[ePlayer];
+
+	return GET_TEAM(GET_PLAYER(ePlayer).getTeam()).getAtWarCount(true);
+}
+
+/// Defensive strength ePlayer's cities add to its military strength, scaled by how healthy each city is
+int CvDiplomacyAI::GetPlayerCityDefenseStrength(PlayerTypes ePlayer) const
+{
+	if(m_bTurnFactsValid)
+		return m_aiTurnFactCityDefenseStrength[ePlayer];
+
+	int iCityDefenseStrength = 0;
+	const CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+	int iCityLoop;
+	for(const CvCity* pLoopCity = kPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iCityLoop))
+	{
+		int iCityStrengthMod = pLoopCity->GetPower();
+		iCityStrengthMod *= (pLoopCity->GetMaxHitPoints() - pLoopCity->getDamage());
+		iCityStrengthMod /= pLoopCity->GetMaxHitPoints();
+		iCityStrengthMod /= 100;
+		iCityStrengthMod *= /*33*/ GC.getMILITARY_STRENGTH_CITY_MOD();
+		iCityStrengthMod /= 100;
+		iCityDefenseStrength += (MAX(iCityStrengthMod, 0));
+	}
+
+	return iCityDefenseStrength;
+}
+
+/// Undamaged defensive strength of ePlayer's cities, along with their total damage and count, as used when judging ePlayer as a target
+int CvDiplomacyAI::GetPlayerCityTargetStrength(PlayerTypes ePlayer, int& iTotalCityDamage, int& iNumCities) const
+{
+	if(m_bTurnFactsValid)
+	{
+		iTotalCityDamage = m_aiTurnFactTotalCityDamage[ePlayer];
+		iNumCities = m_aiTurnFactNumCities[ePlayer];
+		return m_aiTurnFactCityTargetStrength[ePlayer];
+	}
+
+	int iCityTargetStrength = 0;
+	iTotalCityDamage = 0;
+	iNumCities = 0;
+	const CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+	int iCityLoop;
+	for(const CvCity* pLoopCity = kPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iCityLoop))
+	{
+		int iCityStrengthMod = pLoopCity->GetPower();
+		iCityStrengthMod *= /*33*/ GC.getMILITARY_STRENGTH_CITY_MOD();
+		iCityStrengthMod /= 100;
+		iCityTargetStrength += iCityStrengthMod;
+
+		iTotalCityDamage += pLoopCity->getDamage();
+		iNumCities++;
+	}
+
+	return iCityTargetStrength;
+}
+#endif // AUI_DIPLOMACY_TURN_FACTS
+
 /// Have we approached another civ about attacking their protected minor?
 bool CvDiplomacyAI::HasSentAttackProtectedMinorTaunt(PlayerTypes ePlayer, PlayerTypes eMinor)
 {
@@ -1016,6 +1016,13 @@ public:
 	bool IsGoingForSpaceshipVictory();
 
 	bool IsPlayerValid(PlayerTypes eOtherPlayer, bool bMyTeamIsValid = false);
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	// Read from the turn facts while DoTurn is evaluating, computed live otherwise
+	bool IsPlayerValidToUsAndPlayer(PlayerTypes ePlayer, PlayerTypes eOtherPlayer, bool bMyTeamIsValid = false);
+	int GetPlayerTeamAtWarCount(PlayerTypes ePlayer) const;
+	int GetPlayerCityDefenseStrength(PlayerTypes ePlayer) const;
+	int GetPlayerCityTargetStrength(PlayerTypes ePlayer, int& iTotalCityDamage, int& iNumCities) const;
+#endif // AUI_DIPLOMACY_TURN_FACTS
 
 	// Messages sent to other players about protected Minor Civs
 	bool HasSentAttackProtectedMinorTaunt(PlayerTypes ePlayer, PlayerTypes eMinor);
@@ -1543,6 +1550,20 @@ private:
 
 	PlayerTypes			m_eTargetPlayer;
 
+#ifdef AUI_DIPLOMACY_TURN_FACTS
+	void DoBuildTurnFacts();
+
+	// Not serialized, only valid while DoTurn's evaluation passes are running
+	bool m_bTurnFactsValid;
+	bool m_abTurnFactPlayerValid[MAX_MAJOR_CIVS];
+	bool m_abTurnFactPlayerValidWithTeam[MAX_MAJOR_CIVS];
+	bool m_aabTurnFactPlayerKnowsPlayer[MAX_MAJOR_CIVS][MAX_MAJOR_CIVS];
+	int m_aiTurnFactTeamAtWarCount[MAX_CIV_PLAYERS];
+	int m_aiTurnFactCityDefenseStrength[MAX_CIV_PLAYERS];
+	int m_aiTurnFactCityTargetStrength[MAX_CIV_PLAYERS];
+	int m_aiTurnFactTotalCityDamage[MAX_CIV_PLAYERS];
+	int m_aiTurnFactNumCities[MAX_CIV_PLAYERS];
+#endif // AUI_DIPLOMACY_TURN_FACTS
 	// Data members for injecting test messages
 	PlayerTypes			m_eTestToPlayer;
 	DiploStatementTypes m_eTestStatement;
@@ -299,6 +299,9 @@ bool CvDllDatabaseUtility::PrefetchGameData()
 	//Buildings
 	PrefetchCollection(GC.getBuildingClassInfo(), "BuildingClasses");
 	PrefetchCollection(GC.getBuildingInfo(), "Buildings");
+#ifdef AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
+	GC.GetGameBuildings()->CacheMutuallyExclusiveGroups();
+#endif // AUI_CITY_CAN_CONSTRUCT_COMPACT_REQUIREMENTS
 
 	//GameInfo
 	PrefetchCollection(GC.getEmphasisInfo(), "EmphasizeInfos");
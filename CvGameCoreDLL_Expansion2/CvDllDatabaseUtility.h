@@ -115,6 +115,9 @@ bool CvDllDatabaseUtility::PrefetchCollection(std::vector<T*>& kCollection, cons
 	size_t index = 0;
 	Database::Results kResults;
 	CvDatabaseUtility kUtility;
+#ifdef AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
+	kUtility.SetPrefetchChildTables(true);
+#endif // AUI_DATABASE_UTILITY_PREFETCH_CHILD_TABLES
 
 	if(DB.SelectWhere(kResults, tableName, "ID > -1 ORDER BY ID"))
 	{
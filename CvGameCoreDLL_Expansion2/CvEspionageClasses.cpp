@@ -186,6 +186,9 @@ void CvPlayerEspionage::DoTurn()
 	{
 		ProcessSpy(uiSpy);
 	}
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 }
 
 /// AddSpy - Grants the player a spy to use
@@ -321,7 +324,11 @@ void CvPlayerEspionage::ProcessSpy(uint uiSpyIndex)
 					// TODO: need to proclaim surveillance somehow
 					pSpy->m_eSpyState = SPY_STATE_GATHERING_INTEL;
 					pCityEspionage->ResetProgress(ePlayer);
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+					int iPotentialRate = ScaleIntelRateBySpyRank(iBasePotentialRate, eCityOwner, uiSpyIndex);
+#else
 					int iPotentialRate = CalcPerTurn(SPY_STATE_GATHERING_INTEL, pCity, uiSpyIndex);
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 					int iGoal = CalcRequired(SPY_STATE_GATHERING_INTEL, pCity, uiSpyIndex);
 					pCityEspionage->SetActivity(ePlayer, 0, iPotentialRate, iGoal);
 					pCityEspionage->SetLastProgress(ePlayer, iPotentialRate);
@@ -1102,6 +1109,9 @@ bool CvPlayerEspionage::MoveSpyTo(CvCity* pCity, uint uiSpyIndex, bool bAsDiplom
 	{
 		return false;
 	}
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 	if(!CanMoveSpyTo(pCity, uiSpyIndex, bAsDiplomat))
 	{
@@ -1197,6 +1207,9 @@ bool CvPlayerEspionage::ExtractSpyFromCity(uint uiSpyIndex)
 	{
 		return false;
 	}
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 	if(!IsSpyInCity(uiSpyIndex))
 	{
@@ -1299,6 +1312,12 @@ void CvPlayerEspionage::UpdateCity(CvCity* pCity)
 		return;
 	}
 	pCityEspionage->m_aiLastBasePotential[m_pPlayer->GetID()] = CalcPerTurn(m_aSpyList[iSpyIndex].m_eSpyState, pCity, -1);
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+	// The spy's rate while gathering intel is just the base potential scaled by rank, so don't evaluate the city twice
+	if (m_aSpyList[iSpyIndex].m_eSpyState == SPY_STATE_GATHERING_INTEL)
+		pCityEspionage->m_aiLastPotential[m_pPlayer->GetID()] = ScaleIntelRateBySpyRank(pCityEspionage->m_aiLastBasePotential[m_pPlayer->GetID()], pCity->getOwner(), iSpyIndex);
+	else
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 	pCityEspionage->m_aiLastPotential[m_pPlayer->GetID()] = CalcPerTurn(m_aSpyList[iSpyIndex].m_eSpyState, pCity, iSpyIndex);
 	pCityEspionage->m_aiRate[m_pPlayer->GetID()] = pCityEspionage->m_aiLastPotential[m_pPlayer->GetID()];
 }
@@ -1335,6 +1354,9 @@ int CvPlayerEspionage::CalcPerTurn(int iSpyState, CvCity* pCity, int iSpyIndex)
 			int iFinalModifier = (iBaseYieldRate * (100 + iCityEspionageModifier + iPlayerEspionageModifier + iTheirPoliciesEspionageModifier + iMyPoliciesEspionageModifier)) / 100;
 
 			int iResult = max(iFinalModifier, 1);
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+			iResult = ScaleIntelRateBySpyRank(iResult, eCityOwner, iSpyIndex);
+#else
 			if(iSpyIndex >= 0)
 			{
 				int iSpyRank = m_aSpyList[iSpyIndex].m_eRank;
@@ -1342,6 +1364,7 @@ int CvPlayerEspionage::CalcPerTurn(int iSpyState, CvCity* pCity, int iSpyIndex)
 				iResult *= 100 + (GC.getESPIONAGE_GATHERING_INTEL_RATE_BY_SPY_RANK_PERCENT() * iSpyRank);
 				iResult /= 100;
 			}
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 
 			return iResult;
 		}
@@ -1383,6 +1406,21 @@ int CvPlayerEspionage::CalcPerTurn(int iSpyState, CvCity* pCity, int iSpyIndex)
 	return -1;
 }
 
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+/// ScaleIntelRateBySpyRank - Applies a spy's rank to the base (spyless) tech stealing rate of a city
+int CvPlayerEspionage::ScaleIntelRateBySpyRank(int iBaseRate, PlayerTypes eCityOwner, int iSpyIndex) const
+{
+	if(iSpyIndex < 0)
+	{
+		return iBaseRate;
+	}
+
+	int iSpyRank = m_aSpyList[iSpyIndex].m_eRank;
+	iSpyRank += m_pPlayer->GetCulture()->GetInfluenceMajorCivSpyRankBonus(eCityOwner);
+	return iBaseRate * (100 + (GC.getESPIONAGE_GATHERING_INTEL_RATE_BY_SPY_RANK_PERCENT() * iSpyRank)) / 100;
+}
+
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 /// CalcRequired - How much the spy is needed to do to accomplish this task
 int CvPlayerEspionage::CalcRequired(int iSpyState, CvCity* pCity, int iSpyIndex)
 {
@@ -4924,6 +4962,61 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 
 		TeamTypes eTargetTeam = GET_PLAYER(eTargetPlayer).getTeam();
 		CvDiplomacyAI* pTargetDiploAI = GET_PLAYER(eTargetPlayer).GetDiplomacyAI();
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+		// Nothing here depends on the city, so evaluate it once per target civ
+		int iDiploModifier = 1;
+		if (pDiploAI->GetWarGoal(eTargetPlayer) == WAR_GOAL_PREPARE)
+		{
+			iDiploModifier = 1;
+		}
+		else if (GET_TEAM(eTeam).isAtWar(eTargetTeam))
+		{
+			// ignore promises
+			// bonus targeting!
+			iDiploModifier = 1;
+		}
+		else // we're not at war with them, so look at other factors
+		{
+			// raise our diplo modifier by a scale of 10 so that we're less likely to target those we aren't at war with
+			iDiploModifier = 10;
+			// if we promised not to spy, make it less likely that we will spy
+			if (pDiploAI->IsPlayerStopSpyingRequestAccepted(eTargetPlayer))
+			{
+				// target far less frequently
+				iDiploModifier *= 100;
+			}
+
+			// if we've denounced them or they've denounced us, spy bonus!
+			if (pDiploAI->IsDenouncedPlayer(eTargetPlayer) || pTargetDiploAI->IsDenouncedPlayer(ePlayer))
+			{
+				iDiploModifier /= 2;
+			}
+			else if (pDiploAI->IsDoFAccepted(eTargetPlayer))
+			{
+				iDiploModifier *= 50;
+			}
+
+			if (GET_TEAM(eTeam).IsHasResearchAgreement(eTargetTeam))
+			{
+				iDiploModifier *= 5;
+			}
+
+			if (GET_TEAM(eTeam).IsHasDefensivePact(eTargetTeam))
+			{
+				iDiploModifier *= 50;
+			}
+
+			if (GET_TEAM(eTeam).IsAllowsOpenBordersToTeam(eTargetTeam))
+			{
+				iDiploModifier *= 2;
+			}
+
+			if (GET_TEAM(eTargetTeam).IsAllowsOpenBordersToTeam(eTeam))
+			{
+				iDiploModifier *= 2;
+			}
+		}
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 
 		for(pLoopCity = GET_PLAYER(eTargetPlayer).firstCity(&iLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(eTargetPlayer).nextCity(&iLoop))
 		{
@@ -4976,6 +5069,7 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 				}
 			}
 
+#ifndef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 			int iDiploModifier = 1;
 			if (pDiploAI->GetWarGoal(eTargetPlayer) == WAR_GOAL_PREPARE)
 			{
@@ -5029,6 +5123,7 @@ void CvEspionageAI::BuildOffenseCityList(EspionageCityList& aOffenseCityList)
 				}
 			}
 
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 			ScoreCityEntry kEntry;
 			kEntry.m_pCity = pLoopCity;
 
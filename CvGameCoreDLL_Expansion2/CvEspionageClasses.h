@@ -148,6 +148,9 @@ public:
 	void UpdateCity(CvCity* pCity);
 
 	int CalcPerTurn(int iSpyState, CvCity* pCity, int iSpyIndex);
+#ifdef AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
+	int ScaleIntelRateBySpyRank(int iBaseRate, PlayerTypes eCityOwner, int iSpyIndex) const;
+#endif // AUI_ESPIONAGE_SHARED_INTEL_EVALUATION
 	int CalcRequired(int iSpyState, CvCity* pCity, int iSpyIndex);
 
 	const char* GetSpyRankName(int iRank) const;
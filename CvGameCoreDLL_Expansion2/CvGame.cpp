@@ -1068,6 +1068,9 @@ void CvGame::reset(HandicapTypes eHandicap, bool bConstructorCall)
 	uninit();
 
 	m_fCurrentTurnTimerPauseDelta = 0.f;
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	m_bCityDistanceMatrixDirty = true;
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
 
 	CvString strUTF8DatabasePath = gDLL->GetCacheFolderPath();
 	strUTF8DatabasePath += "Civ5SavedGameDatabase.db";
@@ -4386,6 +4389,192 @@ double CvGame::getCurrentMinorCivDeviation()
 }
 #endif // AUI_MINOR_CIV_RATIO
 
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+//	--------------------------------------------------------------------------------
+void CvGame::AddCityToDistanceMatrix(const CvCity& kCity)
+{
+	ChangeCityInDistanceMatrix(kCity, true);
+}
+
+//	--------------------------------------------------------------------------------
+void CvGame::RemoveCityFromDistanceMatrix(const CvCity& kCity)
+{
+	ChangeCityInDistanceMatrix(kCity, false);
+}
+
+//	--------------------------------------------------------------------------------
+/// Number of (their city, our city) pairs between two players
+int CvGame::GetNumCityPairs(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer)
+{
+	CvAssertMsg(eFirstPlayer >= 0 && eFirstPlayer < MAX_PLAYERS, "eFirstPlayer is expected to be within maximum bounds (invalid Index)");
+	CvAssertMsg(eSecondPlayer >= 0 && eSecondPlayer < MAX_PLAYERS, "eSecondPlayer is expected to be within maximum bounds (invalid Index)");
+	if(m_bCityDistanceMatrixDirty)
+	{
+		RebuildCityDistanceMatrix();
+	}
+	return m_aaiNumCityPairs[eFirstPlayer][eSecondPlayer];
+}
+
+//	--------------------------------------------------------------------------------
+/// Sum of the distances of all city pairs between two players
+int CvGame::GetTotalCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer)
+{
+	CvAssertMsg(eFirstPlayer >= 0 && eFirstPlayer < MAX_PLAYERS, "eFirstPlayer is expected to be within maximum bounds (invalid Index)");
+	CvAssertMsg(eSecondPlayer >= 0 && eSecondPlayer < MAX_PLAYERS, "eSecondPlayer is expected to be within maximum bounds (invalid Index)");
+	if(m_bCityDistanceMatrixDirty)
+	{
+		RebuildCityDistanceMatrix();
+	}
+	return m_aaiCityDistanceTotal[eFirstPlayer][eSecondPlayer];
+}
+
+//	--------------------------------------------------------------------------------
+/// Smallest distance between any city of the first player and any city of the second player (number of plots if either has no cities)
+int CvGame::GetMinCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer)
+{
+	CvAssertMsg(eFirstPlayer >= 0 && eFirstPlayer < MAX_PLAYERS, "eFirstPlayer is expected to be within maximum bounds (invalid Index)");
+	CvAssertMsg(eSecondPlayer >= 0 && eSecondPlayer < MAX_PLAYERS, "eSecondPlayer is expected to be within maximum bounds (invalid Index)");
+	if(m_bCityDistanceMatrixDirty)
+	{
+		RebuildCityDistanceMatrix();
+	}
+	if(m_aaiNumCityPairs[eFirstPlayer][eSecondPlayer] <= 0)
+	{
+		return GC.getMap().numPlots();
+	}
+	if(m_aabMinCityDistanceDirty[eFirstPlayer][eSecondPlayer])
+	{
+		RecalculateMinCityDistance(eFirstPlayer, eSecondPlayer);
+	}
+	return m_aaiMinCityDistance[eFirstPlayer][eSecondPlayer];
+}
+
+//	--------------------------------------------------------------------------------
+/// Adds or removes the distances between kCity and every city of every other player; O(number of cities)
+void CvGame::ChangeCityInDistanceMatrix(const CvCity& kCity, bool bAdd)
+{
+	// A full rebuild is already pending and will pick this city up (or not) on its own
+	if(m_bCityDistanceMatrixDirty)
+		return;
+
+	PlayerTypes eOwner = kCity.getOwner();
+	if(eOwner < 0 || eOwner >= MAX_PLAYERS)
+		return;
+
+	int iX = kCity.getX();
+	int iY = kCity.getY();
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		if(iPlayerLoop == eOwner)
+			continue;
+
+		CvPlayer& kOtherPlayer = GET_PLAYER((PlayerTypes)iPlayerLoop);
+		int iCityLoop;
+		for(const CvCity* pLoopCity = kOtherPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kOtherPlayer.nextCity(&iCityLoop))
+		{
+			int iDistance = plotDistance(iX, iY, pLoopCity->getX(), pLoopCity->getY());
+			if(bAdd)
+			{
+				m_aaiCityDistanceTotal[eOwner][iPlayerLoop] += iDistance;
+				m_aaiNumCityPairs[eOwner][iPlayerLoop]++;
+				if(iDistance < m_aaiMinCityDistance[eOwner][iPlayerLoop])
+				{
+					m_aaiMinCityDistance[eOwner][iPlayerLoop] = iDistance;
+				}
+			}
+			else
+			{
+				m_aaiCityDistanceTotal[eOwner][iPlayerLoop] -= iDistance;
+				m_aaiNumCityPairs[eOwner][iPlayerLoop]--;
+				// Can't tell whether another pair shares the minimum, so recalculate it when next needed
+				if(iDistance <= m_aaiMinCityDistance[eOwner][iPlayerLoop])
+				{
+					m_aabMinCityDistanceDirty[eOwner][iPlayerLoop] = true;
+				}
+			}
+		}
+
+		// Matrix is symmetric
+		m_aaiCityDistanceTotal[iPlayerLoop][eOwner] = m_aaiCityDistanceTotal[eOwner][iPlayerLoop];
+		m_aaiNumCityPairs[iPlayerLoop][eOwner] = m_aaiNumCityPairs[eOwner][iPlayerLoop];
+		m_aaiMinCityDistance[iPlayerLoop][eOwner] = m_aaiMinCityDistance[eOwner][iPlayerLoop];
+		m_aabMinCityDistanceDirty[iPlayerLoop][eOwner] = m_aabMinCityDistanceDirty[eOwner][iPlayerLoop];
+	}
+}
+
+//	--------------------------------------------------------------------------------
+void CvGame::RecalculateMinCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer)
+{
+	int iMinDistance = MAX_INT;
+	CvPlayer& kFirstPlayer = GET_PLAYER(eFirstPlayer);
+	CvPlayer& kSecondPlayer = GET_PLAYER(eSecondPlayer);
+	int iFirstLoop;
+	int iSecondLoop;
+	for(const CvCity* pFirstCity = kFirstPlayer.firstCity(&iFirstLoop); pFirstCity != NULL; pFirstCity = kFirstPlayer.nextCity(&iFirstLoop))
+	{
+		for(const CvCity* pSecondCity = kSecondPlayer.firstCity(&iSecondLoop); pSecondCity != NULL; pSecondCity = kSecondPlayer.nextCity(&iSecondLoop))
+		{
+			int iDistance = plotDistance(pFirstCity->getX(), pFirstCity->getY(), pSecondCity->getX(), pSecondCity->getY());
+			if(iDistance < iMinDistance)
+			{
+				iMinDistance = iDistance;
+			}
+		}
+	}
+
+	m_aaiMinCityDistance[eFirstPlayer][eSecondPlayer] = iMinDistance;
+	m_aaiMinCityDistance[eSecondPlayer][eFirstPlayer] = iMinDistance;
+	m_aabMinCityDistanceDirty[eFirstPlayer][eSecondPlayer] = false;
+	m_aabMinCityDistanceDirty[eSecondPlayer][eFirstPlayer] = false;
+}
+
+//	--------------------------------------------------------------------------------
+void CvGame::RebuildCityDistanceMatrix()
+{
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		for(int iJ = 0; iJ < MAX_PLAYERS; iJ++)
+		{
+			m_aaiCityDistanceTotal[iI][iJ] = 0;
+			m_aaiNumCityPairs[iI][iJ] = 0;
+			m_aaiMinCityDistance[iI][iJ] = MAX_INT;
+			m_aabMinCityDistanceDirty[iI][iJ] = false;
+		}
+	}
+	m_bCityDistanceMatrixDirty = false;
+
+	// Adding every city of each player in turn only counts pairs with players that were already added, so each pair is counted once
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes)iPlayerLoop);
+		int iCityLoop;
+		for(const CvCity* pLoopCity = kPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iCityLoop))
+		{
+			int iX = pLoopCity->getX();
+			int iY = pLoopCity->getY();
+			for(int iOtherLoop = 0; iOtherLoop < iPlayerLoop; iOtherLoop++)
+			{
+				CvPlayer& kOtherPlayer = GET_PLAYER((PlayerTypes)iOtherLoop);
+				int iOtherCityLoop;
+				for(const CvCity* pOtherCity = kOtherPlayer.firstCity(&iOtherCityLoop); pOtherCity != NULL; pOtherCity = kOtherPlayer.nextCity(&iOtherCityLoop))
+				{
+					int iDistance = plotDistance(iX, iY, pOtherCity->getX(), pOtherCity->getY());
+					m_aaiCityDistanceTotal[iPlayerLoop][iOtherLoop] += iDistance;
+					m_aaiNumCityPairs[iPlayerLoop][iOtherLoop]++;
+					if(iDistance < m_aaiMinCityDistance[iPlayerLoop][iOtherLoop])
+					{
+						m_aaiMinCityDistance[iPlayerLoop][iOtherLoop] = iDistance;
+					}
+				}
+				m_aaiCityDistanceTotal[iOtherLoop][iPlayerLoop] = m_aaiCityDistanceTotal[iPlayerLoop][iOtherLoop];
+				m_aaiNumCityPairs[iOtherLoop][iPlayerLoop] = m_aaiNumCityPairs[iPlayerLoop][iOtherLoop];
+				m_aaiMinCityDistance[iOtherLoop][iPlayerLoop] = m_aaiMinCityDistance[iPlayerLoop][iOtherLoop];
+			}
+		}
+	}
+}
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
+
 //	------------------------------------------------------------------------------------------------
 int CvGame::getGameTurn()
 {
@@ -7537,6 +7726,10 @@ void CvGame::doTurn()
 
 	gDLL->DoTurn();
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	CvUnit::DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+
 	CvBarbarians::BeginTurn();
 
 	doUpdateCacheOnTurn();
@@ -9118,10 +9311,21 @@ int CvGame::calculateSyncChecksum()
 				break;
 
 			case 1:
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+			{
+				int aiTotalYields[NUM_YIELD_TYPES];
+				GET_PLAYER((PlayerTypes)iI).calculateTotalYields(aiTotalYields);
+				for(iJ = 0; iJ < NUM_YIELD_TYPES; iJ++)
+				{
+					iMultiplier += (aiTotalYields[iJ] * 432754);
+				}
+			}
+#else
 				for(iJ = 0; iJ < NUM_YIELD_TYPES; iJ++)
 				{
 					iMultiplier += (GET_PLAYER((PlayerTypes)iI).calculateTotalYield((YieldTypes)iJ) * 432754);
 				}
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 				break;
 
 			case 2:
@@ -148,6 +148,13 @@ public:
 	double getCurrentMinorCivRatio();
 	double getCurrentMinorCivDeviation();
 #endif // AUI_MINOR_CIV_RATIO
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	void AddCityToDistanceMatrix(const CvCity& kCity);
+	void RemoveCityFromDistanceMatrix(const CvCity& kCity);
+	int GetNumCityPairs(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer);
+	int GetTotalCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer);
+	int GetMinCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer);
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
 
 	int getGameTurn();
 	void setGameTurn(int iNewValue);
@@ -728,6 +735,19 @@ protected:
 	//necessary because we only want to hide the mouseover of the most recently moused over unit -KS
 	int                        m_iLastMouseoverUnitID;
 
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	// Not serialized, rebuilt from all cities on the first query after a reset or load
+	int m_aaiCityDistanceTotal[MAX_PLAYERS][MAX_PLAYERS];
+	int m_aaiNumCityPairs[MAX_PLAYERS][MAX_PLAYERS];
+	int m_aaiMinCityDistance[MAX_PLAYERS][MAX_PLAYERS];
+	bool m_aabMinCityDistanceDirty[MAX_PLAYERS][MAX_PLAYERS];
+	bool m_bCityDistanceMatrixDirty;
+
+	void ChangeCityInDistanceMatrix(const CvCity& kCity, bool bAdd);
+	void RecalculateMinCityDistance(PlayerTypes eFirstPlayer, PlayerTypes eSecondPlayer);
+	void RebuildCityDistanceMatrix();
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
+
 	// CACHE: cache frequently used values
 
 	FTimer  m_endTurnTimer;
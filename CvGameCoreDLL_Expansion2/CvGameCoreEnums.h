@@ -22,6 +22,18 @@ enum YieldTypes
     NUM_YIELD_TYPES
 };
 
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+// Building properties that players keep running counts of
+enum BuildingFlagTypes
+{
+    NO_BUILDING_FLAG = -1,
+
+    BUILDING_FLAG_NULLIFY_INFLUENCE_MODIFIER,
+
+    NUM_BUILDING_FLAG_TYPES
+};
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
+
 // Popups specific to this DLL
 
 // Hashed values.  Use FStringHashGen to create!
@@ -79,6 +79,10 @@ void CvHomelandAI::Reset()
 	m_CurrentBestMoveHighPriorityUnit = NULL;
 	m_iCurrentBestMoveUnitTurns = MAX_INT;
 	m_iCurrentBestMoveHighPriorityUnitTurns = MAX_INT;
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	m_aTurnsToTargetMemo.clear();
+	m_iTurnsToTargetMemoUnitPositionStamp = -1;
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 }
 
 /// Serialization read
@@ -148,6 +152,11 @@ void CvHomelandAI::Update()
 {
 	AI_PERF_FORMAT("AI-perf.csv", ("Homeland AI, Turn %03d, %s", GC.getGame().getElapsedGameTurns(), m_pPlayer->getCivilizationShortDescription()));
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	// Other players' units may have moved since our last update
+	m_aTurnsToTargetMemo.clear();
+
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 	// Make sure we have a unit to handle
 	if(!m_CurrentTurnUnits.empty())
 	{
@@ -1286,7 +1295,11 @@ void CvHomelandAI::PlotWorkerSeaMoves()
 				continue;
 			}
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+			int iMoves = GetMemoizedTurnsToReachTarget(pUnit.pointer(), pTarget);
+#else
 			int iMoves = TurnsToReachTarget(pUnit.pointer(), pTarget);
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 			if (iMoves < iTargetMoves)
 			{
 				iTargetMoves = iMoves;
@@ -3320,7 +3333,11 @@ void CvHomelandAI::ExecuteMoveToTarget(CvPlot* pTarget)
 				return;
 			}
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+			else if(it->GetMovesToTarget() < GC.getAI_HOMELAND_ESTIMATE_TURNS_DISTANCE() || GetMemoizedTurnsToReachTarget(pUnit.pointer(), pTarget) != MAX_INT)
+#else
 			else if(it->GetMovesToTarget() < GC.getAI_HOMELAND_ESTIMATE_TURNS_DISTANCE() || TurnsToReachTarget(pUnit, pTarget) != MAX_INT)
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 			{
 #ifdef AUI_HOMELAND_PARATROOPERS_PARADROP
 				if (!CheckAndExecuteParadrop(pBestUnit, pTarget))
@@ -3351,7 +3368,11 @@ void CvHomelandAI::ExecuteMoveToTarget(CvPlot* pTarget)
 				return;
 			}
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+			else if(it->GetMovesToTarget() < GC.getAI_HOMELAND_ESTIMATE_TURNS_DISTANCE() || GetMemoizedTurnsToReachTarget(pUnit.pointer(), pTarget) != MAX_INT)
+#else
 			else if(it->GetMovesToTarget() < GC.getAI_HOMELAND_ESTIMATE_TURNS_DISTANCE() || TurnsToReachTarget(pUnit, pTarget) != MAX_INT)
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 			{
 #ifdef AUI_HOMELAND_PARATROOPERS_PARADROP
 				if (!CheckAndExecuteParadrop(pBestUnit, pTarget))
@@ -5681,7 +5702,11 @@ bool CvHomelandAI::FindWorkersInSameArea(CvPlot* pTarget, BuildTypes eBuild)
 			if(pLoopUnit->canBuild(pTarget, eBuild))
 			{
 				CvHomelandUnit unit;
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+				int iMoves = GetMemoizedTurnsToReachTarget(pLoopUnit.pointer(), pTarget);
+#else
 				int iMoves = TurnsToReachTarget(pLoopUnit.pointer(), pTarget);
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 
 				if(iMoves != MAX_INT)
 				{
@@ -6015,7 +6040,11 @@ bool CvHomelandAI::GetClosestUnitByTurnsToTarget(CvHomelandAI::MoveUnitsArray &k
 			int iDistance = it->GetMovesToTarget();	// Raw distance
 			if (iDistance == MAX_INT)
 				continue;
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+			int iMoves = GetMemoizedTurnsToReachTarget(pLoopUnit.pointer(), pTarget);
+#else
 			int iMoves = TurnsToReachTarget(pLoopUnit.pointer(), pTarget);
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 			it->SetMovesToTarget(iMoves);
 			// Did we make it at all?
 			if (iMoves != MAX_INT)
@@ -6088,6 +6117,15 @@ bool CvHomelandAI::GetBestUnitToReachTarget(CvPlot* pTarget, int iMaxTurns)
 				continue;
 			}
 
+#ifdef AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+			// Units stuck on another landmass can never get there, no need to ask the pathfinder
+			if (IsTargetOffUnitLandmass(pLoopUnit.pointer(), pTarget))
+			{
+				it->SetMovesToTarget(MAX_INT);
+				continue;
+			}
+
+#endif // AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
 			int iPlotDistance = plotDistance(pLoopUnit->getX(), pLoopUnit->getY(), iTargetX, iTargetY);
 			it->SetMovesToTarget(iPlotDistance);
 		}
@@ -6114,6 +6152,15 @@ bool CvHomelandAI::GetBestUnitToReachTarget(CvPlot* pTarget, int iMaxTurns)
 				continue;
 			}
 
+#ifdef AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+			// Units stuck on another landmass can never get there, no need to ask the pathfinder
+			if (IsTargetOffUnitLandmass(pLoopUnit.pointer(), pTarget))
+			{
+				it->SetMovesToTarget(MAX_INT);
+				continue;
+			}
+
+#endif // AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
 			int iPlotDistance = plotDistance(pLoopUnit->getX(), pLoopUnit->getY(), iTargetX, iTargetY);
 			it->SetMovesToTarget(iPlotDistance);
 		}
@@ -6130,6 +6177,92 @@ bool CvHomelandAI::GetBestUnitToReachTarget(CvPlot* pTarget, int iMaxTurns)
 	return m_CurrentBestMoveHighPriorityUnit != NULL || m_CurrentBestMoveUnit != NULL;
 }
 
+#ifdef AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+//	---------------------------------------------------------------------------
+/// Is the target in a different area than a land unit that has no way of leaving its own area?
+bool CvHomelandAI::IsTargetOffUnitLandmass(const CvUnit* pUnit, const CvPlot* pTarget) const
+{
+	if (pUnit->getDomainType() != DOMAIN_LAND || pTarget->isWater())
+		return false;
+
+	// Units that can cross water in any way have to go through the pathfinder
+	if (pUnit->CanEverEmbark() || pUnit->IsHoveringUnit() || pUnit->canMoveAllTerrain() || pUnit->getDropRange() > 0)
+		return false;
+
+	return pUnit->getArea() != pTarget->getArea();
+}
+#endif // AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+//	---------------------------------------------------------------------------
+/// TurnsToReachTarget() with default settings, reusing results from earlier in this homeland update as long as no unit has moved since
+int CvHomelandAI::GetMemoizedTurnsToReachTarget(CvUnit* pUnit, CvPlot* pTarget)
+{
+	// Results depend on where all units stand (stacking, blocked paths), so any unit changing plots invalidates the whole memo
+	const int iUnitPositionStamp = GC.getMap().GetUnitPositionStamp();
+	if (iUnitPositionStamp != m_iTurnsToTargetMemoUnitPositionStamp)
+	{
+		m_aTurnsToTargetMemo.clear();
+		m_iTurnsToTargetMemoUnitPositionStamp = iUnitPositionStamp;
+	}
+
+	const int iUnitPlot = pUnit->plot()->GetPlotIndex();
+	const int iMovesLeft = pUnit->getMoves();
+	std::vector<CvTurnsToTargetMemoEntry>& aEntries = m_aTurnsToTargetMemo[pTarget->GetPlotIndex()];
+
+	uint uiI = 0;
+	while (uiI < aEntries.size())
+	{
+		CvTurnsToTargetMemoEntry& kEntry = aEntries[uiI];
+		const bool bSameStart = (kEntry.m_iUnitPlot == iUnitPlot && kEntry.m_iMovesLeft == iMovesLeft);
+		if (kEntry.m_iUnitID == pUnit->GetID())
+		{
+			if (bSameStart)
+				return kEntry.m_iTurns;
+			// Unit has spent moves since, so its old entry is dropped
+			kEntry = aEntries.back();
+			aEntries.pop_back();
+			continue;
+		}
+		if (bSameStart && kEntry.m_eUnitType == pUnit->getUnitType() && kEntry.m_bEmbarked == pUnit->isEmbarked())
+		{
+			CvUnit* pOtherUnit = m_pPlayer->getUnit(kEntry.m_iUnitID);
+			if (pOtherUnit && IsSameMovementClass(pUnit, pOtherUnit))
+				return kEntry.m_iTurns;
+		}
+		uiI++;
+	}
+
+	CvTurnsToTargetMemoEntry kNewEntry;
+	kNewEntry.m_iUnitID = pUnit->GetID();
+	kNewEntry.m_eUnitType = pUnit->getUnitType();
+	kNewEntry.m_iUnitPlot = iUnitPlot;
+	kNewEntry.m_iMovesLeft = iMovesLeft;
+	kNewEntry.m_bEmbarked = pUnit->isEmbarked();
+	kNewEntry.m_iTurns = TurnsToReachTarget(pUnit, pTarget);
+	aEntries.push_back(kNewEntry);
+
+	return kNewEntry.m_iTurns;
+}
+
+//	---------------------------------------------------------------------------
+/// Will the pathfinder treat both units the same way (same unit type, embark state, and promotions)?
+bool CvHomelandAI::IsSameMovementClass(const CvUnit* pUnit, const CvUnit* pOtherUnit) const
+{
+	if (pUnit->getUnitType() != pOtherUnit->getUnitType() || pUnit->isEmbarked() != pOtherUnit->isEmbarked())
+		return false;
+
+	for (int iI = 0; iI < GC.getNumPromotionInfos(); iI++)
+	{
+		const PromotionTypes ePromotion = (PromotionTypes)iI;
+		if (pUnit->isHasPromotion(ePromotion) != pOtherUnit->isHasPromotion(ePromotion))
+			return false;
+	}
+
+	return true;
+}
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+
 /// Move up to our target avoiding our own units if possible
 bool CvHomelandAI::MoveToEmptySpaceNearTarget(CvUnit* pUnit, CvPlot* pTarget, bool bLand)
 {
@@ -304,6 +304,13 @@ private:
 	bool ExecuteGoldenAgeMove(CvUnit* pUnit);
 	bool IsValidExplorerEndTurnPlot(const CvUnit* pUnit, CvPlot* pPlot) const;
 	bool GetClosestUnitByTurnsToTarget(MoveUnitsArray &kMoveUnits, CvPlot* pTarget, int iMaxTurns, CvUnit** ppClosestUnit, int* piClosestTurns);
+#ifdef AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+	bool IsTargetOffUnitLandmass(const CvUnit* pUnit, const CvPlot* pTarget) const;
+#endif // AUI_HOMELAND_GET_BEST_UNIT_LANDMASS_PREFILTER
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	int GetMemoizedTurnsToReachTarget(CvUnit* pUnit, CvPlot* pTarget);
+	bool IsSameMovementClass(const CvUnit* pUnit, const CvUnit* pOtherUnit) const;
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 	void ClearCurrentMoveUnits();
 	void ClearCurrentMoveHighPriorityUnits();
 
@@ -342,6 +349,21 @@ private:
 	std::vector<CvHomelandTarget> m_TargetedAncientRuins;
 	std::vector<CvHomelandTarget> m_TargetedAntiquitySites;
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	struct CvTurnsToTargetMemoEntry
+	{
+		int m_iUnitID;
+		UnitTypes m_eUnitType;
+		int m_iUnitPlot;
+		int m_iMovesLeft;
+		bool m_bEmbarked;
+		int m_iTurns;
+	};
+	// Memoized turns to target, keyed by target plot index; only valid for the current homeland update and while no unit has moved
+	std::map<int, std::vector<CvTurnsToTargetMemoEntry> > m_aTurnsToTargetMemo;	// NOT SERIALIZED
+	int m_iTurnsToTargetMemoUnitPositionStamp;										// NOT SERIALIZED
+
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 	// Targeting ranges (pulled in from GlobalAIDefines.XML)
 	int m_iRandomRange;
 	int m_iDefensiveMoveTurns;
@@ -746,6 +746,221 @@ DECLARE_SERIALIZATION_INFO_TYPE_HELPER(ImprovementTypes);
 bool Write(FDataStream& kStream, const CvBaseInfo* pkInfo);
 /// Helper function to write out an info type ID as a hash
 bool WriteHashed(FDataStream& kStream, const CvBaseInfo* pkInfo);
+
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+//////////////////////////////////////////////////////////////////////////
+/// Type dictionaries
+/// A dictionary stores the hash of every runtime type of one info category once. Arrays and single types
+/// of that category that follow it in the stream are written as plain indices, and are translated back
+/// on load through the flat translation vector built from the last dictionary read for the category.
+//////////////////////////////////////////////////////////////////////////
+
+/// Translation vector (saved index -> runtime index, -1 if the type no longer exists) of the last dictionary read for TType
+template<typename TType>
+struct TypeDictionary
+{
+	static std::vector<int> ms_aiRemap;
+};
+template<typename TType>
+std::vector<int> TypeDictionary<TType>::ms_aiRemap;
+
+/// Helper function to write out the hash of every runtime type of TType
+template<typename TType>
+void WriteTypeDictionary(FDataStream& kStream, uint uiNumTypes)
+{
+	kStream << uiNumTypes;
+
+	for(uint iI = 0; iI < uiNumTypes; iI++)
+	{
+		WriteHashed(kStream, static_cast<TType>(iI));
+	}
+}
+
+/// Helper function to read in a dictionary of TType and rebuild its translation vector
+template<typename TType>
+void ReadTypeDictionary(FDataStream& kStream)
+{
+	std::vector<int>& aiRemap = TypeDictionary<TType>::ms_aiRemap;
+	uint uiNumTypes;
+
+	kStream >> uiNumTypes;
+
+	aiRemap.resize(uiNumTypes);
+	for(uint iI = 0; iI < uiNumTypes; iI++)
+	{
+		aiRemap[iI] = ReadHashed(kStream);
+	}
+}
+
+/// Converts a saved (dense) index of TType to the type index for the currently loaded data
+template<typename TType>
+inline int RemapType(int iSavedType)
+{
+	const std::vector<int>& aiRemap = TypeDictionary<TType>::ms_aiRemap;
+	if(iSavedType >= 0 && iSavedType < (int)aiRemap.size())
+		return aiRemap[iSavedType];
+
+	return -1;
+}
+
+/// Helper function to write out a single type as a dense index
+inline void WriteDenseType(FDataStream& kStream, int iType)
+{
+	kStream << iType;
+}
+
+/// Helper function to read a single dense index of TType and convert it to an ID
+template<typename TType>
+int ReadDenseType(FDataStream& kStream)
+{
+	int iSavedType;
+	kStream >> iSavedType;
+	return RemapType<TType>(iSavedType);
+}
+
+/// Helper function to write out an array of TData data without per entry types, assuming the array index is the runtime ID index
+template<typename TData>
+void WriteDenseDataArray(FDataStream& kStream, const TData* paArray, uint uiArraySize)
+{
+	kStream << uiArraySize;
+
+	for(uint iI = 0; iI < uiArraySize; iI++)
+	{
+		kStream << paArray[iI];
+	}
+}
+
+/// Helper function to write out an std::vector of TData data without per entry types, assuming the array index is the runtime ID index
+template<typename TData>
+void WriteDenseDataArray(FDataStream& kStream, const std::vector<TData>& aArray)
+{
+	kStream << aArray.size();
+
+	for(uint iI = 0; iI < aArray.size(); iI++)
+	{
+		kStream << aArray[iI];
+	}
+}
+
+/// Helper function to write out a two dimensional array of TData data without per entry types, assuming the primary index is the runtime ID index
+template<typename TData>
+void WriteDenseDataArray(FDataStream& kStream, TData** ppaArray, uint uiSubArraySize, uint uiArraySize)
+{
+	kStream << uiArraySize;
+
+	for(uint iI = 0; iI < uiArraySize; iI++)
+	{
+		TData* paArray = ppaArray[iI];
+		for(uint iJ = 0; iJ < uiSubArraySize; ++iJ)
+		{
+			kStream << paArray[iJ];
+		}
+	}
+}
+
+/// Helper function to write out an array of TType types as dense indices
+template<typename TType>
+void WriteDenseTypeArray(FDataStream& kStream, const std::vector<TType>& aArray)
+{
+	kStream << aArray.size();
+
+	for(uint iI = 0; iI < aArray.size(); iI++)
+	{
+		WriteDenseType(kStream, (int)aArray[iI]);
+	}
+}
+
+/// Helper function to read in an array of T data written by WriteDenseDataArray and remap it through the TType dictionary
+template<typename TType, typename TData>
+void ReadDenseDataArray(FDataStream& kStream, TData* paArray, int iArraySize)
+{
+	uint uiNumEntries;
+
+	kStream >> uiNumEntries;
+
+	for(uint iI = 0; iI < uiNumEntries; iI++)
+	{
+		TData tValue;
+		kStream >> tValue;
+		int iType = RemapType<TType>(iI);
+		if(iType != -1 && iType < iArraySize)
+			paArray[iType] = tValue;
+	}
+}
+
+/// Helper function to read in an std::vector of T data written by WriteDenseDataArray and remap it through the TType dictionary
+template<typename TType, typename TData>
+void ReadDenseDataArray(FDataStream& kStream, std::vector<TData>& aArray)
+{
+	uint uiNumEntries;
+
+	kStream >> uiNumEntries;
+
+	if(aArray.size() < uiNumEntries)
+		aArray.resize(uiNumEntries);
+
+	for(uint iI = 0; iI < uiNumEntries; iI++)
+	{
+		TData tValue;
+		kStream >> tValue;
+		int iType = RemapType<TType>(iI);
+		if(iType != -1)
+		{
+			if(iType >= (int)aArray.size())
+				aArray.resize(iType+1);
+
+			aArray[iType] = tValue;
+		}
+	}
+}
+
+/// Helper function to read in a two dimensional array of T data written by WriteDenseDataArray and remap it through the TType dictionary
+template<typename TType, typename TData>
+void ReadDenseDataArray(FDataStream& kStream, TData** ppaArray, int iSubArraySize, int iArraySize)
+{
+	uint uiNumEntries;
+
+	kStream >> uiNumEntries;
+
+	for(uint iI = 0; iI < uiNumEntries; iI++)
+	{
+		int iType = RemapType<TType>(iI);
+		TData tValue;
+		if(iType != -1 && iType < iArraySize)
+		{
+			TData* paArray = ppaArray[iType];
+			for(int iJ = 0; iJ < iSubArraySize; ++iJ)
+			{
+				kStream >> tValue;
+				paArray[iJ] = tValue;
+			}
+		}
+		else
+		{
+			// Burn through the data of types that no longer exist
+			for(int iJ = 0; iJ < iSubArraySize; ++iJ)
+				kStream >> tValue;
+		}
+	}
+}
+
+/// Helper function to read in an array of dense TType indices and convert them to runtime type entries
+template<typename TType>
+void ReadDenseTypeArray(FDataStream& kStream, std::vector<TType>& aArray)
+{
+	uint uiNumEntries;
+
+	kStream >> uiNumEntries;
+
+	if(aArray.size() < uiNumEntries)
+		aArray.resize(uiNumEntries);
+
+	for(uint iI = 0; iI < uiNumEntries; iI++)
+	{
+		aArray[iI] = (TType)ReadDenseType<TType>(kStream);
+	}
+}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 }
 
 #endif // CVINFOSSERIALIZATIONHELPER_H
\ No newline at end of file
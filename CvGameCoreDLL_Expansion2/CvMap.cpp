@@ -209,6 +209,182 @@ FDataStream& operator>>(FDataStream& loadFrom, CvLandmass& writeTo)
 	return loadFrom;
 }
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+//////////////////////////////////////////////////////////////////////////////
+// CvUnitPowerField
+//////////////////////////////////////////////////////////////////////////
+
+//	--------------------------------------------------------------------------------
+CvUnitPowerField::CvUnitPowerField()
+{
+	m_iWidth = 0;
+	m_iHeight = 0;
+	m_bWrapX = false;
+	m_bWrapY = false;
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::Init(int iWidth, int iHeight, bool bWrapX, bool bWrapY)
+{
+	Uninit();
+
+	if(iWidth <= 0 || iHeight <= 0)
+		return;
+
+	m_iWidth = iWidth;
+	m_iHeight = iHeight;
+	m_bWrapX = bWrapX;
+	m_bWrapY = bWrapY;
+	for(int iLayer = 0; iLayer < NUM_FIELD_LAYERS; iLayer++)
+	{
+		m_aiValues[iLayer].resize(iWidth * iHeight, 0);
+		m_aiRowPrefixSums[iLayer].resize((iWidth + 1) * iHeight, 0);
+	}
+	m_abRowDirty.resize(iHeight, false);
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::Uninit()
+{
+	m_iWidth = 0;
+	m_iHeight = 0;
+	for(int iLayer = 0; iLayer < NUM_FIELD_LAYERS; iLayer++)
+	{
+		m_aiValues[iLayer].clear();
+		m_aiRowPrefixSums[iLayer].clear();
+	}
+	m_abRowDirty.clear();
+	m_aiAirUnitIDs.clear();
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::ChangePlotValues(int iPlotIndex, int iPowerChange, int iGreatGeneralChange)
+{
+	CvAssertMsg(iPlotIndex >= 0 && iPlotIndex < m_iWidth * m_iHeight, "Plot index out of bounds for unit power field");
+	if(iPlotIndex < 0 || iPlotIndex >= m_iWidth * m_iHeight)
+		return;
+
+	m_aiValues[FIELD_LAYER_POWER][iPlotIndex] += iPowerChange;
+	m_aiValues[FIELD_LAYER_GREAT_GENERALS][iPlotIndex] += iGreatGeneralChange;
+	m_abRowDirty[iPlotIndex / m_iWidth] = true;
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::AddAirUnit(int iUnitID)
+{
+	if(std::find(m_aiAirUnitIDs.begin(), m_aiAirUnitIDs.end(), iUnitID) == m_aiAirUnitIDs.end())
+	{
+		m_aiAirUnitIDs.push_back(iUnitID);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::RemoveAirUnit(int iUnitID)
+{
+	std::vector<int>::iterator it = std::find(m_aiAirUnitIDs.begin(), m_aiAirUnitIDs.end(), iUnitID);
+	if(it != m_aiAirUnitIDs.end())
+	{
+		m_aiAirUnitIDs.erase(it);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+int CvUnitPowerField::GetPowerInRange(int iX, int iY, int iRange) const
+{
+	return GetLayerSumInRange(FIELD_LAYER_POWER, iX, iY, iRange);
+}
+
+//	--------------------------------------------------------------------------------
+int CvUnitPowerField::GetNumGreatGeneralsInRange(int iX, int iY, int iRange) const
+{
+	return GetLayerSumInRange(FIELD_LAYER_GREAT_GENERALS, iX, iY, iRange);
+}
+
+//	--------------------------------------------------------------------------------
+/// Sums a layer over all plots within iRange of (iX, iY); each row of the hex disc is a contiguous span of the storage row
+int CvUnitPowerField::GetLayerSumInRange(int iLayer, int iX, int iY, int iRange) const
+{
+	if(!IsInitialized() || iRange < 0)
+		return 0;
+
+	int iHexX = xToHexspaceX(iX, iY);
+	int iTotal = 0;
+	for(int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+		int iRowY = iY + iDY;
+		int iRow = coordRange(iRowY, m_iHeight, m_bWrapY);
+		if(iRow < 0 || iRow >= m_iHeight)
+			continue;
+
+		// Same bounds as the AUI_HEXSPACE_DX_LOOPS pattern, converted back to storage coordinates
+		int iFirstHexX = iHexX - iRange - (iDY < 0 ? iDY : 0);
+		int iLength = 2 * iRange + 1 - abs(iDY);
+		iTotal += GetLayerSumInRow(iLayer, iRow, hexspaceXToX(iFirstHexX, iRowY), iLength);
+	}
+	return iTotal;
+}
+
+//	--------------------------------------------------------------------------------
+int CvUnitPowerField::GetLayerSumInRow(int iLayer, int iRow, int iFirstX, int iLength) const
+{
+	if(iLength <= 0)
+		return 0;
+
+	if(m_abRowDirty[iRow])
+	{
+		UpdateRowPrefixSums(iRow);
+	}
+	const int* paiPrefix = &m_aiRowPrefixSums[iLayer][iRow * (m_iWidth + 1)];
+
+	int iLastX;
+	if(m_bWrapX)
+	{
+		if(iLength >= m_iWidth)
+		{
+			return paiPrefix[m_iWidth];
+		}
+		iFirstX %= m_iWidth;
+		if(iFirstX < 0)
+		{
+			iFirstX += m_iWidth;
+		}
+		iLastX = iFirstX + iLength - 1;
+		if(iLastX >= m_iWidth)
+		{
+			// Span wraps around the seam
+			return (paiPrefix[m_iWidth] - paiPrefix[iFirstX]) + paiPrefix[iLastX - m_iWidth + 1];
+		}
+	}
+	else
+	{
+		iLastX = std::min(iFirstX + iLength - 1, m_iWidth - 1);
+		iFirstX = std::max(iFirstX, 0);
+		if(iFirstX > iLastX)
+		{
+			return 0;
+		}
+	}
+
+	return paiPrefix[iLastX + 1] - paiPrefix[iFirstX];
+}
+
+//	--------------------------------------------------------------------------------
+void CvUnitPowerField::UpdateRowPrefixSums(int iRow) const
+{
+	for(int iLayer = 0; iLayer < NUM_FIELD_LAYERS; iLayer++)
+	{
+		const int* paiValues = &m_aiValues[iLayer][iRow * m_iWidth];
+		int* paiPrefix = &m_aiRowPrefixSums[iLayer][iRow * (m_iWidth + 1)];
+		paiPrefix[0] = 0;
+		for(int iX = 0; iX < m_iWidth; iX++)
+		{
+			paiPrefix[iX + 1] = paiPrefix[iX] + paiValues[iX];
+		}
+	}
+	m_abRowDirty[iRow] = false;
+}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+
 static uint sgCvMapInstanceCount = 0;
 //////////////////////////////////////////////////////////////////////////////
 
@@ -231,6 +407,11 @@ CvMap::CvMap()
 	m_pYields = NULL;
 	m_pFoundValue = NULL;
 	m_pPlayerCityRadiusCount = NULL;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	m_pPlayerHomeFrontCount = NULL;
+	m_bHomeFrontCountsDirty = true;
+	m_iHomeFrontCountsRange = 0;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	m_pVisibilityCount = NULL;
 	m_pRevealedOwner = NULL;
 	m_pRevealed = NULL;
@@ -240,6 +421,12 @@ CvMap::CvMap()
 	m_pResourceForceReveal = NULL;
 
 	m_iAIMapHints = 0;
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	m_iLatestFoundValueDirtyStamp = 0;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	m_iUnitPositionStamp = 0;
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 
 	reset(&defaultMapData);
 }
@@ -263,6 +450,9 @@ void CvMap::InitPlots()
 	m_pYields					= FNEW(short[NUM_YIELD_TYPES*iNumPlots], c_eCiv5GameplayDLL, 0);
 	m_pFoundValue				= FNEW(int[REALLY_MAX_PLAYERS*iNumPlots], c_eCiv5GameplayDLL, 0);
 	m_pPlayerCityRadiusCount	= FNEW(char[REALLY_MAX_PLAYERS*iNumPlots], c_eCiv5GameplayDLL, 0);
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	m_pPlayerHomeFrontCount		= FNEW(char[REALLY_MAX_PLAYERS*iNumPlots], c_eCiv5GameplayDLL, 0);
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	m_pVisibilityCount			= FNEW(short[REALLY_MAX_TEAMS*iNumPlots], c_eCiv5GameplayDLL, 0);
 	m_pRevealedOwner			= FNEW(char[REALLY_MAX_TEAMS*iNumPlots], c_eCiv5GameplayDLL, 0);
 	m_pRevealed					= FNEW(bool[REALLY_MAX_TEAMS*iNumPlots], c_eCiv5GameplayDLL, 0);
@@ -274,6 +464,10 @@ void CvMap::InitPlots()
 	memset(m_pYields, 0, NUM_YIELD_TYPES*iNumPlots*sizeof(short));
 	memset(m_pFoundValue, 0, REALLY_MAX_PLAYERS*iNumPlots*sizeof(int));
 	memset(m_pPlayerCityRadiusCount, 0, REALLY_MAX_PLAYERS*iNumPlots*sizeof(char));
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	memset(m_pPlayerHomeFrontCount, 0, REALLY_MAX_PLAYERS*iNumPlots*sizeof(char));
+	m_bHomeFrontCountsDirty = true;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	memset(m_pVisibilityCount, 0,REALLY_MAX_TEAMS*iNumPlots *sizeof(short));
 	memset(m_pRevealedOwner, -1 ,REALLY_MAX_TEAMS*iNumPlots *sizeof(char));
 	memset(m_pRevealed, 0,REALLY_MAX_TEAMS*iNumPlots *sizeof(bool));
@@ -286,6 +480,9 @@ void CvMap::InitPlots()
 	short* pYields					= m_pYields;
 	int*   pFoundValue				= m_pFoundValue;
 	char*  pPlayerCityRadiusCount   = m_pPlayerCityRadiusCount;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	char*  pPlayerHomeFrontCount    = m_pPlayerHomeFrontCount;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	short* pVisibilityCount			= m_pVisibilityCount;
 	char*  pRevealedOwner			= m_pRevealedOwner;
 	short* pRevealedImprovementType = m_pRevealedImprovementType;
@@ -298,6 +495,9 @@ void CvMap::InitPlots()
 		m_pMapPlots[i].m_aiYield				= pYields;
 		m_pMapPlots[i].m_aiFoundValue			= pFoundValue;
 		m_pMapPlots[i].m_aiPlayerCityRadiusCount= pPlayerCityRadiusCount;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+		m_pMapPlots[i].m_aiPlayerHomeFrontCount	= pPlayerHomeFrontCount;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 		m_pMapPlots[i].m_aiVisibilityCount		= pVisibilityCount;
 		m_pMapPlots[i].m_aiRevealedOwner		= pRevealedOwner;
 
@@ -311,6 +511,9 @@ void CvMap::InitPlots()
 		pYields					+= NUM_YIELD_TYPES;
 		pFoundValue				+= REALLY_MAX_PLAYERS;
 		pPlayerCityRadiusCount  += REALLY_MAX_PLAYERS;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+		pPlayerHomeFrontCount   += REALLY_MAX_PLAYERS;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 		pVisibilityCount		+= REALLY_MAX_TEAMS;
 		pRevealedOwner			+= REALLY_MAX_TEAMS;
 		pRevealedImprovementType+= REALLY_MAX_TEAMS;
@@ -376,6 +579,10 @@ void CvMap::uninit()
 	SAFE_DELETE_ARRAY(m_pYields);
 	SAFE_DELETE_ARRAY(m_pFoundValue);
 	SAFE_DELETE_ARRAY(m_pPlayerCityRadiusCount);
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	SAFE_DELETE_ARRAY(m_pPlayerHomeFrontCount);
+	m_bHomeFrontCountsDirty = true;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	SAFE_DELETE_ARRAY(m_pVisibilityCount);
 	SAFE_DELETE_ARRAY(m_pRevealedOwner);
 	SAFE_DELETE_ARRAY(m_pRevealed);
@@ -394,6 +601,10 @@ void CvMap::uninit()
 	m_areas.Uninit();
 	m_landmasses.Uninit();
 	m_kPlotManager.Uninit();
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+
+	ResetUnitPowerFields();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 }
 
 //	--------------------------------------------------------------------------------
@@ -1441,17 +1652,44 @@ void CvMap::Read(FDataStream& kStream)
 	kStream >> wrapm_guid;
 
 	CvAssertMsg((0 < GC.getNumResourceInfos()), "GC.getNumResourceInfos() is not greater than zero but an array is being allocated");
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (uiVersion >= 2)
+	{
+		// Type dictionaries used by the map arrays and by every plot
+		CvInfosSerializationHelper::ReadTypeDictionary<ResourceTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<FeatureTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<ImprovementTypes>(kStream);
+
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNumResource, GC.getNumResourceInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
+	}
+	else
+	{
+		CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResource, GC.getNumResourceInfos());
+		CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
+	}
+#else
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResource, GC.getNumResourceInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	if(numPlots() > 0)
 	{
 		InitPlots();
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+		if (uiVersion >= 3)
+			CvPlot::readColumnar(kStream, m_pMapPlots, numPlots());
+		else
+		{
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 		int iI;
 		for(iI = 0; iI < numPlots(); iI++)
 		{
 			m_pMapPlots[iI].read(kStream);
 		}
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+		}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	}
 
 	// call the read of the free list CvArea class allocations
@@ -1476,7 +1714,13 @@ void CvMap::Read(FDataStream& kStream)
 void CvMap::Write(FDataStream& kStream) const
 {
 	// Current version number
+#if defined(AUI_MAP_COLUMNAR_PLOT_SERIALIZATION)
+	uint uiVersion = 3;
+#elif defined(AUI_SERIALIZATION_TYPE_DICTIONARY)
+	uint uiVersion = 2;
+#else
 	uint uiVersion = 1;
+#endif
 	kStream << uiVersion;
 
 	kStream << m_iGridWidth;
@@ -1495,14 +1739,27 @@ void CvMap::Write(FDataStream& kStream) const
 	kStream << ArrayWrapper<const unsigned char>(8, m_guid.Data4);
 
 	CvAssertMsg((0 < GC.getNumResourceInfos()), "GC.getNumResourceInfos() is not greater than zero but an array is being allocated");
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteTypeDictionary<ResourceTypes>(kStream, GC.getNumResourceInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<FeatureTypes>(kStream, GC.getNumFeatureInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<ImprovementTypes>(kStream, GC.getNumImprovementInfos());
+
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_paiNumResource, GC.getNumResourceInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes>(kStream, m_paiNumResource, GC.getNumResourceInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes>(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	CvPlot::writeColumnar(kStream, m_pMapPlots, numPlots());
+#else
 	int iI;
 	for(iI = 0; iI < numPlots(); iI++)
 	{
 		m_pMapPlots[iI].write(kStream);
 	}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 
 	// call the read of the free list CvArea class allocations
 	kStream << m_areas;
@@ -2312,6 +2569,154 @@ int CvMap::Validate()
 	return iErrors;
 }
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+//	--------------------------------------------------------------------------------
+/// Returns the player's unit power field, building it from the player's units if it hasn't been built since the map was last reset
+const CvUnitPowerField& CvMap::GetUnitPowerField(PlayerTypes ePlayer)
+{
+	CvAssertMsg(ePlayer >= 0 && ePlayer < MAX_PLAYERS, "ePlayer is expected to be within maximum bounds (invalid Index)");
+	CvUnitPowerField& kField = m_aUnitPowerFields[ePlayer];
+	if(!kField.IsInitialized())
+	{
+		kField.Init(getGridWidth(), getGridHeight(), isWrapX(), isWrapY());
+		if(kField.IsInitialized())
+		{
+			CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+			int iLoop;
+			for(CvUnit* pLoopUnit = kPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoop))
+			{
+				pLoopUnit->UpdateUnitPowerField(true);
+			}
+		}
+	}
+	return kField;
+}
+
+//	--------------------------------------------------------------------------------
+CvUnitPowerField* CvMap::GetUnitPowerFieldIfBuilt(PlayerTypes ePlayer)
+{
+	if(ePlayer < 0 || ePlayer >= MAX_PLAYERS)
+		return NULL;
+
+	CvUnitPowerField& kField = m_aUnitPowerFields[ePlayer];
+	return kField.IsInitialized() ? &kField : NULL;
+}
+
+//	--------------------------------------------------------------------------------
+void CvMap::ResetUnitPowerFields()
+{
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_aUnitPowerFields[iI].Uninit();
+	}
+}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+//	--------------------------------------------------------------------------------
+/// Adds iChange to ePlayer's home front count of every plot closer than AI_DIPLO_PLOT_RANGE_FROM_CITY_HOME_FRONT to pCityPlot
+void CvMap::ChangeHomeFrontCounts(const CvPlot* pCityPlot, PlayerTypes ePlayer, int iChange)
+{
+	// Counts will be rebuilt from scratch anyway
+	if(m_bHomeFrontCountsDirty || m_pPlayerHomeFrontCount == NULL || pCityPlot == NULL || ePlayer < 0 || ePlayer >= REALLY_MAX_PLAYERS)
+		return;
+
+	const int iRange = m_iHomeFrontCountsRange - 1;
+	CvPlot* pLoopPlot;
+	int iDX, iMaxDX;
+	for(int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+#ifdef AUI_FAST_COMP
+		iMaxDX = iRange - FASTMAX(0, iDY);
+		for(iDX = -iRange - FASTMIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#else
+		iMaxDX = iRange - MAX(0, iDY);
+		for(iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#endif // AUI_FAST_COMP
+		{
+			pLoopPlot = plotXY(pCityPlot->getX(), pCityPlot->getY(), iDX, iDY);
+			if(pLoopPlot != NULL)
+			{
+				pLoopPlot->m_aiPlayerHomeFrontCount[ePlayer] += iChange;
+				CvAssert(pLoopPlot->m_aiPlayerHomeFrontCount[ePlayer] >= 0);
+			}
+		}
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Rebuilds all home front counts from the players' cities if they were invalidated (eg. by loading a game) or the home front range changed
+void CvMap::ValidateHomeFrontCounts()
+{
+	const int iRange = GC.getAI_DIPLO_PLOT_RANGE_FROM_CITY_HOME_FRONT();
+	if(!m_bHomeFrontCountsDirty && m_iHomeFrontCountsRange == iRange)
+		return;
+	if(m_pPlayerHomeFrontCount == NULL)
+		return;
+
+	memset(m_pPlayerHomeFrontCount, 0, REALLY_MAX_PLAYERS*numPlots()*sizeof(char));
+	m_bHomeFrontCountsDirty = false;
+	m_iHomeFrontCountsRange = iRange;
+
+	CvCity* pLoopCity;
+	int iCityLoop;
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		PlayerTypes eLoopPlayer = (PlayerTypes)iPlayerLoop;
+		CvPlayer& kLoopPlayer = GET_PLAYER(eLoopPlayer);
+		for(pLoopCity = kLoopPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kLoopPlayer.nextCity(&iCityLoop))
+		{
+			ChangeHomeFrontCounts(pLoopCity->plot(), eLoopPlayer, 1);
+		}
+	}
+}
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
+
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+//	--------------------------------------------------------------------------------
+/// Marks the found values of all plots within iRange of (iX, iY) as needing a recompute
+void CvMap::DirtyFoundValues(int iX, int iY, int iRange)
+{
+	const int iNumPlots = numPlots();
+	m_iLatestFoundValueDirtyStamp++;
+	if((int)m_aiFoundValueDirtyStamp.size() != iNumPlots)
+	{
+		// Map changed size, everything is dirty
+		m_aiFoundValueDirtyStamp.assign(iNumPlots, m_iLatestFoundValueDirtyStamp);
+		return;
+	}
+
+	CvPlot* pLoopPlot;
+	int iDX, iMaxDX;
+	for(int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+#ifdef AUI_FAST_COMP
+		iMaxDX = iRange - FASTMAX(0, iDY);
+		for(iDX = -iRange - FASTMIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#else
+		iMaxDX = iRange - MAX(0, iDY);
+		for(iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+#endif // AUI_FAST_COMP
+		{
+			pLoopPlot = plotXY(iX, iY, iDX, iDY);
+			if(pLoopPlot != NULL)
+			{
+				m_aiFoundValueDirtyStamp[plotNum(pLoopPlot->getX(), pLoopPlot->getY())] = m_iLatestFoundValueDirtyStamp;
+			}
+		}
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Stamp of the last change that dirtied this plot's found value; plots never dirtied return 0
+int CvMap::GetFoundValueDirtyStamp(int iPlotIndex) const
+{
+	if(iPlotIndex < 0 || iPlotIndex >= (int)m_aiFoundValueDirtyStamp.size())
+		return 0;
+	return m_aiFoundValueDirtyStamp[iPlotIndex];
+}
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+
 //	--------------------------------------------------------------------------------
 void CvMap::ChangeAIMapHint(int iMapHint)
 {
@@ -93,6 +93,57 @@ inline int coordRange(int iCoord, int iRange, bool bWrap)
 
 class CvPlotManager;
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+//
+// CvUnitPowerField
+// Per-player grid of combat unit power and great general counts; each map row keeps a lazily rebuilt prefix sum so that hex disc queries cost O(range) instead of O(units)
+//
+class CvUnitPowerField
+{
+public:
+	CvUnitPowerField();
+
+	void Init(int iWidth, int iHeight, bool bWrapX, bool bWrapY);
+	void Uninit();
+	bool IsInitialized() const
+	{
+		return m_iWidth > 0;
+	}
+
+	void ChangePlotValues(int iPlotIndex, int iPowerChange, int iGreatGeneralChange);
+	void AddAirUnit(int iUnitID);
+	void RemoveAirUnit(int iUnitID);
+	const std::vector<int>& GetAirUnits() const
+	{
+		return m_aiAirUnitIDs;
+	}
+
+	int GetPowerInRange(int iX, int iY, int iRange) const;
+	int GetNumGreatGeneralsInRange(int iX, int iY, int iRange) const;
+
+private:
+	enum FieldLayerTypes
+	{
+	    FIELD_LAYER_POWER,
+	    FIELD_LAYER_GREAT_GENERALS,
+	    NUM_FIELD_LAYERS
+	};
+
+	int GetLayerSumInRange(int iLayer, int iX, int iY, int iRange) const;
+	int GetLayerSumInRow(int iLayer, int iRow, int iFirstX, int iLength) const;
+	void UpdateRowPrefixSums(int iRow) const;
+
+	int m_iWidth;
+	int m_iHeight;
+	bool m_bWrapX;
+	bool m_bWrapY;
+	std::vector<int> m_aiValues[NUM_FIELD_LAYERS];
+	mutable std::vector<int> m_aiRowPrefixSums[NUM_FIELD_LAYERS]; // (width + 1) entries per row
+	mutable std::vector<bool> m_abRowDirty;
+	std::vector<int> m_aiAirUnitIDs;
+};
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+
 //
 // CvMap
 //
@@ -295,6 +346,39 @@ public:
 	int GetAIMapHint();
 	// End Natural Wonders stuff
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	// Unit power fields (not serialized, built on first query)
+	const CvUnitPowerField& GetUnitPowerField(PlayerTypes ePlayer);
+	CvUnitPowerField* GetUnitPowerFieldIfBuilt(PlayerTypes ePlayer);
+	void ResetUnitPowerFields();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	// Home front counts (not serialized, rebuilt from the cities on first use after a load)
+	void ChangeHomeFrontCounts(const CvPlot* pCityPlot, PlayerTypes ePlayer, int iChange);
+	void ValidateHomeFrontCounts();
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	// Found value dirtying (not serialized, players do a full update after loading)
+	void DirtyFoundValues(int iX, int iY, int iRange);
+	int GetFoundValueDirtyStamp(int iPlotIndex) const;
+	int GetLatestFoundValueDirtyStamp() const
+	{
+		return m_iLatestFoundValueDirtyStamp;
+	}
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	// Unit position stamp (not serialized), bumped whenever any unit changes plots so memoized path results can tell they may be stale
+	void DirtyUnitPositions()
+	{
+		m_iUnitPositionStamp++;
+	}
+	int GetUnitPositionStamp() const
+	{
+		return m_iUnitPositionStamp;
+	}
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+
 	typedef FStaticVector<CvPlot*, 1000, true, c_eCiv5GameplayDLL, 1> DeferredPlotArray;
 	DeferredPlotArray m_vDeferredFogPlots; // don't serialize me
 
@@ -326,6 +410,11 @@ protected:
 	short* m_pYields;
 	int*   m_pFoundValue;
 	char*  m_pPlayerCityRadiusCount;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	char*  m_pPlayerHomeFrontCount;
+	bool   m_bHomeFrontCountsDirty;
+	int    m_iHomeFrontCountsRange;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	short* m_pVisibilityCount;
 	char*  m_pRevealedOwner;
 	bool*  m_pRevealed;
@@ -340,6 +429,17 @@ protected:
 	GUID m_guid;
 
 	CvPlotManager	m_kPlotManager;
+
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	CvUnitPowerField m_aUnitPowerFields[MAX_PLAYERS];
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	std::vector<int> m_aiFoundValueDirtyStamp;
+	int m_iLatestFoundValueDirtyStamp; // never reset, so stamps stay monotonic across map resets
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	int m_iUnitPositionStamp;
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 };
 
 #endif
@@ -979,20 +979,31 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 {
 	int iFriendlyLoop;
 	int iEnemyLoop;
+#ifndef AUI_MAP_UNIT_POWER_FIELDS
 	int iUnitLoop;
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 	CvCity* pFriendlyCity;
 	CvCity* pEnemyCity;
+#ifndef AUI_MAP_UNIT_POWER_FIELDS
 	CvUnit* pLoopUnit;
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 	static CvWeightedVector<CvMilitaryTarget, SAFE_ESTIMATE_NUM_CITIES* 10, true> weightedTargetList;
 	CvMilitaryTarget chosenTarget;
 	CvPlayer &kEnemy = GET_PLAYER(eEnemy);
 
 	// Estimate the relative strength of units near our cities and near their cities (can't use TacticalAnalysisMap because we may not be at war - and that it isn't current if we are calling this from the DiploAI)
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	const CvUnitPowerField& kFriendlyField = GC.getMap().GetUnitPowerField(m_pPlayer->GetID());
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 	for (pFriendlyCity = m_pPlayer->firstCity(&iFriendlyLoop); pFriendlyCity != NULL; pFriendlyCity = m_pPlayer->nextCity(&iFriendlyLoop))
 	{
 		CvPlot* pPlot = pFriendlyCity->plot();
 		int iX = pPlot->getX();
 		int iY = pPlot->getY();
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+		bool bGeneralInTheVicinity = (kFriendlyField.GetNumGreatGeneralsInRange(iX, iY, 5) > 0);
+		int iPower = kFriendlyField.GetPowerInRange(iX, iY, 5);
+#else
 		bool bGeneralInTheVicinity = false;
 		int iPower = 0;
 		for (pLoopUnit = m_pPlayer->firstUnit(&iUnitLoop); pLoopUnit != NULL; pLoopUnit = m_pPlayer->nextUnit(&iUnitLoop))
@@ -1014,6 +1025,7 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 				}
 			}
 		}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 		if (bGeneralInTheVicinity)
 		{
 			iPower *= 11;
@@ -1021,6 +1033,9 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 		}
 		pFriendlyCity->iScratch = iPower;
 	}
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	const CvUnitPowerField& kEnemyField = GC.getMap().GetUnitPowerField(eEnemy);
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 	for(pEnemyCity = kEnemy.firstCity(&iEnemyLoop); pEnemyCity != NULL; pEnemyCity = kEnemy.nextCity(&iEnemyLoop))
 	{
 		CvPlot* pPlot = pEnemyCity->plot();
@@ -1028,6 +1043,10 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 		{
 			int iX = pPlot->getX();
 			int iY = pPlot->getY();
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+			bool bGeneralInTheVicinity = (kEnemyField.GetNumGreatGeneralsInRange(iX, iY, 5) > 0);
+			int iPower = kEnemyField.GetPowerInRange(iX, iY, 5);
+#else
 			bool bGeneralInTheVicinity = false;
 			int iPower = 0;
 			for (pLoopUnit = kEnemy.firstUnit(&iUnitLoop); pLoopUnit != NULL; pLoopUnit = kEnemy.nextUnit(&iUnitLoop))
@@ -1049,6 +1068,7 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 					}
 				}
 			}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 			if (bGeneralInTheVicinity)
 			{
 				iPower *= 11;
@@ -4252,11 +4272,21 @@ int CvMilitaryAI::GetNumEnemyAirUnitsInRange(CvPlot* pCenterPlot, int /*iRange*/
 			if (atWar(kPlayer.getTeam(), m_pPlayer->getTeam()))
 			{
 				// Loop through their units looking for bombers (this will allow us to find bombers on carriers also
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+				// Only their air units need to be looked at, and the unit power field already keeps a list of those
+				const std::vector<int>& aiAirUnitIDs = GC.getMap().GetUnitPowerField(kPlayer.GetID()).GetAirUnits();
+				for (std::vector<int>::const_iterator it = aiAirUnitIDs.begin(); it != aiAirUnitIDs.end(); ++it)
+				{
+					CvUnit* pLoopUnit = kPlayer.getUnit(*it);
+					if (pLoopUnit != NULL)
+					{
+#else
 				int iLoopUnit = 0;
 				for(CvUnit* pLoopUnit = kPlayer.firstUnit(&iLoopUnit); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoopUnit))
 				{
 					if (pLoopUnit->getDomainType() == DOMAIN_AIR)
 					{
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 #ifdef AUI_MILITARY_NUM_AIR_UNITS_IN_RANGE_DYNAMIC_RANGE
 						// AMS: Just to keep fighters closer to high range bombers (stealth bombers)
 						int iMaxCheckRange = MIN(pLoopUnit->GetRange(), 12);
@@ -7948,13 +7948,19 @@ int CvMinorCivAI::CalculateBullyMetric(PlayerTypes eBullyPlayer, bool bForUnit,
 	int iMinorCapitalY = pMinorCapitalPlot->getY();
 	int iMinorLocalPower = 0;
 	int iBullyLocalPower = 0;
+#ifndef AUI_MAP_UNIT_POWER_FIELDS
 	CvPlot* pLoopPlot;
 	IDInfo* pUnitNode;
 	CvUnit* pLoopUnit;
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 
 	// Include the minor's city power
 	iMinorLocalPower += pMinorCapital->GetPower();
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	iBullyLocalPower += GC.getMap().GetUnitPowerField(eBullyPlayer).GetPowerInRange(iMinorCapitalX, iMinorCapitalY, iComparisonRadius);
+	iMinorLocalPower += GC.getMap().GetUnitPowerField(GetPlayer()->GetID()).GetPowerInRange(iMinorCapitalX, iMinorCapitalY, iComparisonRadius);
+#else
 #ifdef AUI_HEXSPACE_DX_LOOPS
 	int iMaxDX, iDX;
 	for (int iDY = -iComparisonRadius; iDY <= iComparisonRadius; iDY++)
@@ -8007,6 +8013,7 @@ int CvMinorCivAI::CalculateBullyMetric(PlayerTypes eBullyPlayer, bool bForUnit,
 			}
 		}
 	}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 	float fLocalPowerRatio = (float)iBullyLocalPower / (float)iMinorLocalPower;
 	int iLocalPowerScore = 0;
 	if(fLocalPowerRatio >= 3.0)
@@ -62,7 +62,11 @@
 // Version 1 
 //	 * CvPlayer save version reset for expansion pack 2.
 //------------------------------------------------------------------------------
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+const int g_CurrentCvPlayerVersion = 17;
+#else
 const int g_CurrentCvPlayerVersion = 16;
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 //Simply empty check utility.
 bool isEmpty(const char* szString)
@@ -886,6 +890,12 @@ void CvPlayer::uninit()
 	m_iMilitaryMight = 0;
 	m_iEconomicMight = 0;
 	m_iTurnMightRecomputed = -1;
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	m_iUnitMilitaryMight = 0;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	m_auiBuiltInReplayDataSets.clear();
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 	m_iNewCityExtraPopulation = 0;
 	m_iFreeFoodBox = 0;
 	m_iScenarioScore1 = 0;
@@ -992,6 +1002,14 @@ void CvPlayer::reset(PlayerTypes eID, bool bConstructorCall)
 	// tutorial info
 	m_bEverPoppedGoody = false;
 
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	for (int iI = 0; iI < NUM_BUILDING_FLAG_TYPES; iI++)
+	{
+		m_aiNumBuildingsWithFlag[iI] = 0;
+	}
+	m_uiOwnedBuildingFlags = 0;
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
+
 	m_aiCityYieldChange.clear();
 	m_aiCityYieldChange.resize(NUM_YIELD_TYPES, 0);
 
@@ -8817,6 +8835,37 @@ int CvPlayer::calculateTotalYield(YieldTypes eYield) const
 	return iTotalYield / 100;
 }
 
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+//	--------------------------------------------------------------------------------
+/// Same as calculateTotalYield() for every yield in uiYieldMask (bit per YieldTypes) with only one pass over our cities; yields not in the mask are set to 0
+void CvPlayer::calculateTotalYields(int* aiTotalYields, uint uiYieldMask) const
+{
+	int aiTotalYieldsTimes100[NUM_YIELD_TYPES];
+	int aiCityYieldsTimes100[NUM_YIELD_TYPES];
+	int iI;
+	for(iI = 0; iI < NUM_YIELD_TYPES; iI++)
+	{
+		aiTotalYieldsTimes100[iI] = 0;
+	}
+
+	const CvCity* pLoopCity;
+	int iLoop = 0;
+	for(pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+	{
+		pLoopCity->getYieldRatesTimes100(aiCityYieldsTimes100, false, uiYieldMask);
+		for(iI = 0; iI < NUM_YIELD_TYPES; iI++)
+		{
+			aiTotalYieldsTimes100[iI] += aiCityYieldsTimes100[iI];
+		}
+	}
+
+	for(iI = 0; iI < NUM_YIELD_TYPES; iI++)
+	{
+		aiTotalYields[iI] = aiTotalYieldsTimes100[iI] / 100;
+	}
+}
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
+
 //	--------------------------------------------------------------------------------
 /// How much does Production is being eaten up by Units? (cached)
 int CvPlayer::GetUnitProductionMaintenanceMod() const
@@ -9863,6 +9912,9 @@ int CvPlayer::GetCultureYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 {
 	// Culture per turn yield is tracked in replay data, so use that
 	int iSum = 0;
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	unsigned int uiDataSet = getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN");
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 	for (int iI = 0; iI < iNumPreviousTurnsToCount; iI++)
 	{
 		int iTurn = iGameTurn - iI;
@@ -9871,7 +9923,11 @@ int CvPlayer::GetCultureYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+		int iTurnCulture = getReplayDataValue(uiDataSet, iTurn);
+#else
 		int iTurnCulture = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN"), iTurn);
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 		if (iTurnCulture >= 0)
 		{
 			iSum += iTurnCulture;
@@ -13169,6 +13225,9 @@ int CvPlayer::GetGreatGeneralCombatBonus() const
 //////////////////////////////////////////////////////////////////////////
 void CvPlayer::SetGreatGeneralCombatBonus(int iValue)
 {
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	CvUnit::DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 	m_iGreatGeneralCombatBonus = iValue;
 }
 
@@ -15275,6 +15334,9 @@ void CvPlayer::changeCitiesLost(int iChange)
 //	--------------------------------------------------------------------------------
 int CvPlayer::getPower() const
 {
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	return calculateMilitaryMight() + GetEconomicMight();
+#else
 	if(m_iTurnMightRecomputed < GC.getGame().getElapsedGameTurns())
 	{
 		// more lazy evaluation
@@ -15283,11 +15345,16 @@ int CvPlayer::getPower() const
 		const_cast<CvPlayer*>(this)->m_iEconomicMight = calculateEconomicMight();
 	}
 	return m_iMilitaryMight + m_iEconomicMight;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 }
 
 //	--------------------------------------------------------------------------------
 int CvPlayer::GetMilitaryMight() const
 {
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	// Unit total is kept exact by the units themselves, only the gold multiplier is applied here
+	return calculateMilitaryMight();
+#else
 	if(m_iTurnMightRecomputed < GC.getGame().getElapsedGameTurns())
 	{
 		// more lazy evaluation
@@ -15296,6 +15363,7 @@ int CvPlayer::GetMilitaryMight() const
 		const_cast<CvPlayer*>(this)->m_iEconomicMight = calculateEconomicMight();
 	}
 	return m_iMilitaryMight;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 }
 
 //	--------------------------------------------------------------------------------
@@ -15305,7 +15373,11 @@ int CvPlayer::GetEconomicMight() const
 	{
 		// more lazy evaluation
 		const_cast<CvPlayer*>(this)->m_iTurnMightRecomputed = GC.getGame().getElapsedGameTurns();
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+		// City yields are derived on demand from dozens of sources with no single change point to hook, so economic might stays a once-per-turn snapshot
+#else
 		const_cast<CvPlayer*>(this)->m_iMilitaryMight = calculateMilitaryMight();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 		const_cast<CvPlayer*>(this)->m_iEconomicMight = calculateEconomicMight();
 	}
 	return m_iEconomicMight;
@@ -15314,6 +15386,9 @@ int CvPlayer::GetEconomicMight() const
 //	--------------------------------------------------------------------------------
 int CvPlayer::calculateMilitaryMight() const
 {
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	int rtnValue = GetUnitMilitaryMight();
+#else
 	int rtnValue = 0;
 	const CvUnit* pLoopUnit;
 	int iLoop;
@@ -15328,6 +15403,7 @@ int CvPlayer::calculateMilitaryMight() const
 		}
 		rtnValue += iPower;
 	}
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 
 	//Simplistic increase based on player's gold
 	//500 gold will increase might by 22%, 2000 by 45%, 8000 gold by 90%
@@ -15339,6 +15415,35 @@ int CvPlayer::calculateMilitaryMight() const
 	return rtnValue;
 }
 
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+//	--------------------------------------------------------------------------------
+/// Sum of all units' military might before the gold multiplier is applied
+int CvPlayer::GetUnitMilitaryMight() const
+{
+	return m_iUnitMilitaryMight;
+}
+
+//	--------------------------------------------------------------------------------
+void CvPlayer::ChangeUnitMilitaryMight(int iChange)
+{
+	m_iUnitMilitaryMight += iChange;
+	CvAssertMsg(m_iUnitMilitaryMight >= 0, "Unit military might total is expected to be non-negative");
+}
+
+//	--------------------------------------------------------------------------------
+/// Rebuilds the unit military might total from scratch, needed after loading since neither the total nor unit contributions are serialized
+void CvPlayer::RecalculateUnitMilitaryMight()
+{
+	m_iUnitMilitaryMight = 0;
+
+	int iLoop;
+	for(CvUnit* pLoopUnit = firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = nextUnit(&iLoop))
+	{
+		pLoopUnit->UpdateMilitaryMightContribution(true);
+	}
+}
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+
 
 //	--------------------------------------------------------------------------------
 int CvPlayer::calculateEconomicMight() const
@@ -15349,12 +15454,19 @@ int CvPlayer::calculateEconomicMight() const
 	iEconomicMight += getTotalPopulation();
 
 	// todo: add weights to these in an xml
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+	int aiTotalYields[NUM_YIELD_TYPES];
+	calculateTotalYields(aiTotalYields, (1 << YIELD_PRODUCTION) | (1 << YIELD_GOLD));
+	iEconomicMight += aiTotalYields[YIELD_PRODUCTION];
+	iEconomicMight += aiTotalYields[YIELD_GOLD];
+#else
 	//iEconomicMight += calculateTotalYield(YIELD_FOOD);
 	iEconomicMight += calculateTotalYield(YIELD_PRODUCTION);
 	//iEconomicMight += calculateTotalYield(YIELD_SCIENCE);
 	iEconomicMight += calculateTotalYield(YIELD_GOLD);
 	//iEconomicMight += calculateTotalYield(YIELD_CULTURE);
 	//iEconomicMight += calculateTotalYield(YIELD_FAITH);
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 
 	return iEconomicMight;
 }
@@ -15703,6 +15815,9 @@ void CvPlayer::setAlive(bool bNewValue, bool bNotify)
 	if(isAlive() != bNewValue)
 	{
 		m_bAlive = bNewValue;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+		CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 		GET_TEAM(getTeam()).changeAliveCount((isAlive()) ? 1 : -1);
 
@@ -16926,6 +17041,9 @@ int CvPlayer::GetScienceYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 {
 	// Beakers per turn yield is tracked in replay data, so use that
 	int iSum = 0;
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	unsigned int uiDataSet = getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN");
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 	for (int iI = 0; iI < iNumPreviousTurnsToCount; iI++)
 	{
 		int iTurn = iGameTurn - iI;
@@ -16934,7 +17052,11 @@ int CvPlayer::GetScienceYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+		int iTurnScience = getReplayDataValue(uiDataSet, iTurn);
+#else
 		int iTurnScience = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN"), iTurn);
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 		if (iTurnScience >= 0)
 		{
 			iSum += iTurnScience;
@@ -17203,6 +17325,12 @@ void CvPlayer::DoUpdateProximityToPlayer(PlayerTypes ePlayer)
 	CvAssertMsg(ePlayer >= 0, "eIndex is expected to be non-negative (invalid Index)");
 	CvAssertMsg(ePlayer < MAX_PLAYERS, "eIndex is expected to be within maximum bounds (invalid Index)");
 
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	CvGame& kGame = GC.getGame();
+	int iNumCityConnections = kGame.GetNumCityPairs(GetID(), ePlayer);
+	int iSmallestDistanceBetweenCities = kGame.GetMinCityDistance(GetID(), ePlayer);
+	int iAverageDistanceBetweenCities = kGame.GetTotalCityDistance(GetID(), ePlayer);
+#else
 	int iSmallestDistanceBetweenCities = GC.getMap().numPlots();
 	int iAverageDistanceBetweenCities = 0;
 
@@ -17239,6 +17367,7 @@ void CvPlayer::DoUpdateProximityToPlayer(PlayerTypes ePlayer)
 			iAverageDistanceBetweenCities += iTempDistance;
 		}
 	}
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
 
 	// Seed this value with something reasonable to start.  This will be the value assigned if one player has 0 Cities.
 	PlayerProximityTypes eProximity = NO_PLAYER_PROXIMITY;
@@ -18446,6 +18575,89 @@ void CvPlayer::changeBuildingClassCount(BuildingClassTypes eIndex, int iChange)
 	CvAssert(getBuildingClassCount(eIndex) >= 0);
 }
 
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+//	--------------------------------------------------------------------------------
+/// How many buildings with this flag does the player own across all of its cities?
+int CvPlayer::GetNumBuildingsWithFlag(BuildingFlagTypes eFlag) const
+{
+	CvAssertMsg(eFlag >= 0, "eFlag is expected to be non-negative (invalid Index)");
+	CvAssertMsg(eFlag < NUM_BUILDING_FLAG_TYPES, "eFlag is expected to be within maximum bounds (invalid Index)");
+	return m_aiNumBuildingsWithFlag[eFlag];
+}
+
+//	--------------------------------------------------------------------------------
+/// Does the player own at least one building with this flag? (single bit test)
+bool CvPlayer::HasBuildingWithFlag(BuildingFlagTypes eFlag) const
+{
+	CvAssertMsg(eFlag >= 0, "eFlag is expected to be non-negative (invalid Index)");
+	CvAssertMsg(eFlag < NUM_BUILDING_FLAG_TYPES, "eFlag is expected to be within maximum bounds (invalid Index)");
+	return (m_uiOwnedBuildingFlags & (1 << eFlag)) != 0;
+}
+
+//	--------------------------------------------------------------------------------
+/// Called whenever the number of buildings in one of our cities changes; uiFlags is the building's flag bitmask
+void CvPlayer::ChangeNumBuildingsWithFlags(uint uiFlags, int iChange)
+{
+	if (uiFlags == 0 || iChange == 0)
+		return;
+
+	for (int iI = 0; iI < NUM_BUILDING_FLAG_TYPES; iI++)
+	{
+		if (uiFlags & (1 << iI))
+		{
+			m_aiNumBuildingsWithFlag[iI] += iChange;
+			CvAssert(m_aiNumBuildingsWithFlag[iI] >= 0);
+
+			if (m_aiNumBuildingsWithFlag[iI] > 0)
+				m_uiOwnedBuildingFlags |= (1 << iI);
+			else
+				m_uiOwnedBuildingFlags &= ~(1 << iI);
+		}
+	}
+
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+}
+
+//	--------------------------------------------------------------------------------
+/// Rebuilds building flag counts from scratch (used after loading, since the counts are not serialized)
+void CvPlayer::RecalculateBuildingFlagCounts()
+{
+	for (int iI = 0; iI < NUM_BUILDING_FLAG_TYPES; iI++)
+	{
+		m_aiNumBuildingsWithFlag[iI] = 0;
+	}
+	m_uiOwnedBuildingFlags = 0;
+
+	CvCity* pLoopCity;
+	int iLoop;
+	for (pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+	{
+		for (int iBuildingLoop = 0; iBuildingLoop < GC.getNumBuildingInfos(); iBuildingLoop++)
+		{
+			const BuildingTypes eBuilding = (BuildingTypes)iBuildingLoop;
+			CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eBuilding);
+			if (pkBuildingInfo && pkBuildingInfo->GetBuildingFlags() != 0)
+			{
+				int iNumBuilding = pLoopCity->GetCityBuildings()->GetNumBuilding(eBuilding);
+				if (iNumBuilding > 0)
+				{
+					for (int iI = 0; iI < NUM_BUILDING_FLAG_TYPES; iI++)
+					{
+						if (pkBuildingInfo->GetBuildingFlags() & (1 << iI))
+						{
+							m_aiNumBuildingsWithFlag[iI] += iNumBuilding;
+							m_uiOwnedBuildingFlags |= (1 << iI);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
+
 
 //	--------------------------------------------------------------------------------
 int CvPlayer::getBuildingClassMaking(BuildingClassTypes eIndex) const
@@ -19221,13 +19433,26 @@ const CvCity* CvPlayer::getCity(int iID) const
 //	--------------------------------------------------------------------------------
 CvCity* CvPlayer::addCity()
 {
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 	return(m_cities.Add());
 }
 
 //	--------------------------------------------------------------------------------
 void CvPlayer::deleteCity(int iID)
 {
+#ifdef AUI_GAME_CITY_DISTANCE_MATRIX
+	CvCity* pCity = getCity(iID);
+	if(pCity != NULL)
+	{
+		GC.getGame().RemoveCityFromDistanceMatrix(*pCity);
+	}
+#endif // AUI_GAME_CITY_DISTANCE_MATRIX
 	m_cities.RemoveAt(iID);
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 }
 
 //	--------------------------------------------------------------------------------
@@ -19582,6 +19807,19 @@ const char* CvPlayer::getReplayDataSetName(unsigned int idx) const
 //	--------------------------------------------------------------------------------
 unsigned int CvPlayer::getReplayDataSetIndex(const char* szDataSetName)
 {
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	// Compare against the raw string, only build a CvString if the dataset is new
+	unsigned int idx = 0;
+	for(std::vector<CvString>::const_iterator it = m_ReplayDataSets.begin(); it != m_ReplayDataSets.end(); ++it)
+	{
+		if(strcmp(it->c_str(), szDataSetName) == 0)
+			return idx;
+
+		idx++;
+	}
+
+	m_ReplayDataSets.push_back(CvString(szDataSetName));
+#else
 	CvString dataSetName = szDataSetName;
 
 	unsigned int idx = 0;
@@ -19594,6 +19832,7 @@ unsigned int CvPlayer::getReplayDataSetIndex(const char* szDataSetName)
 	}
 
 	m_ReplayDataSets.push_back(dataSetName);
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 	m_ReplayDataSetValues.push_back(TurnData());
 	return m_ReplayDataSets.size() - 1;
 }
@@ -19624,6 +19863,18 @@ void CvPlayer::setReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn, i
 }
 
 //	--------------------------------------------------------------------------------
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+const CvPlayer::TurnData& CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
+{
+	if(uiDataSet < m_ReplayDataSetValues.size())
+	{
+		return m_ReplayDataSetValues[uiDataSet];
+	}
+
+	static const CvPlayer::TurnData s_kEmptyTurnData;
+	return s_kEmptyTurnData;
+}
+#else
 CvPlayer::TurnData CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
@@ -19633,6 +19884,7 @@ CvPlayer::TurnData CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
 
 	return CvPlayer::TurnData();
 }
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 
 //	--------------------------------------------------------------------------------
 std::string CvPlayer::getScriptData() const
@@ -22231,6 +22483,29 @@ void CvPlayer::Read(FDataStream& kStream)
 	kStream >> m_strScriptData;
 
 	CvAssertMsg((0 < GC.getNumResourceInfos()), "GC.getNumResourceInfos() is not greater than zero but it is expected to be in CvPlayer::read");
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	bool bTypeDictionary = (uiVersion >= 17);
+	if (bTypeDictionary)
+	{
+		// Type dictionaries used by the player arrays and by every city of the player
+		CvInfosSerializationHelper::ReadTypeDictionary<ResourceTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<BuildingTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<PromotionTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<UnitTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<FeatureTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<TerrainTypes>(kStream);
+
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNumResourceUsed.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiNumResourceTotal.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiResourceGiftedToMinors.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiResourceExport.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiResourceImport.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiResourceFromMinors.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<ResourceTypes>(kStream, m_paiResourcesSiphoned.dirtyGet());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResourceUsed.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiNumResourceTotal.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiResourceGiftedToMinors.dirtyGet());
@@ -22246,11 +22521,27 @@ void CvPlayer::Read(FDataStream& kStream)
 		m_paiResourcesSiphoned.clear();
 		m_paiResourcesSiphoned.resize(GC.getNumResourceInfos(), 0);
 	}
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream >> m_paiImprovementCount;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<BuildingTypes>(kStream, m_paiFreeBuildingCount.dirtyGet());
+		CvInfosSerializationHelper::ReadDenseDataArray<PromotionTypes>(kStream, m_paiFreePromotionCount.dirtyGet());
+	}
+	else
+	{
+		CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreeBuildingCount.dirtyGet());
+		CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreePromotionCount.dirtyGet());
+	}
+#else
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreeBuildingCount.dirtyGet());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiFreePromotionCount.dirtyGet());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream >> m_paiUnitCombatProductionModifiers;
 	kStream >> m_paiUnitCombatFreeExperiences;
@@ -22333,6 +22624,14 @@ void CvPlayer::Read(FDataStream& kStream)
 	kStream >> m_units;
 	kStream >> m_armyAIs;
 
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	RecalculateUnitMilitaryMight();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	RecalculateBuildingFlagCounts();
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
+
 	{
 		m_AIOperations.clear();
 		uint iSize;
@@ -22359,6 +22658,9 @@ void CvPlayer::Read(FDataStream& kStream)
 
 	kStream >> m_ReplayDataSets;
 	kStream >> m_ReplayDataSetValues;
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	m_auiBuiltInReplayDataSets.clear();
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 
 	kStream >> m_aVote;
 	kStream >> m_aUnitExtraCosts;
@@ -22579,7 +22881,12 @@ void CvPlayer::Write(FDataStream& kStream) const
 	kStream << m_iConversionTimer;
 	kStream << m_iCapitalCityID;
 	kStream << m_iCitiesLost;
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	// The member is no longer kept up to date, so save the value it would have held
+	kStream << GetMilitaryMight();
+#else
 	kStream << m_iMilitaryMight;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 	kStream << m_iEconomicMight;
 	kStream << m_iTurnMightRecomputed;
 	kStream << m_iNewCityExtraPopulation;
@@ -22683,6 +22990,28 @@ void CvPlayer::Write(FDataStream& kStream) const
 	kStream << m_strScriptData;
 
 	CvAssertMsg((0 < GC.getNumResourceInfos()), "GC.getNumResourceInfos() is not greater than zero but an array is being allocated in CvPlayer::write");
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteTypeDictionary<ResourceTypes>(kStream, GC.getNumResourceInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<BuildingTypes>(kStream, GC.getNumBuildingInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<PromotionTypes>(kStream, GC.getNumPromotionInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<UnitTypes>(kStream, GC.getNumUnitInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<FeatureTypes>(kStream, GC.getNumFeatureInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<TerrainTypes>(kStream, GC.getNumTerrainInfos());
+
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiNumResourceUsed);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiNumResourceTotal);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiResourceGiftedToMinors);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiResourceExport);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiResourceImport);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiResourceFromMinors);
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiResourcesSiphoned);
+
+	kStream << m_paiImprovementCount;
+
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiFreeBuildingCount);
+
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiFreePromotionCount);
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiNumResourceUsed);
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiNumResourceTotal);
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes, int>(kStream, m_paiResourceGiftedToMinors);
@@ -22696,6 +23025,7 @@ void CvPlayer::Write(FDataStream& kStream) const
 	CvInfosSerializationHelper::WriteHashedDataArray<BuildingTypes, int>(kStream, m_paiFreeBuildingCount);
 
 	CvInfosSerializationHelper::WriteHashedDataArray<PromotionTypes, int>(kStream, m_paiFreePromotionCount);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream << m_paiUnitCombatProductionModifiers;
 	kStream << m_paiUnitCombatFreeExperiences;
@@ -24953,6 +25283,73 @@ void CvPlayer::checkInitialTurnAIProcessed()
 	}
 }
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+namespace
+{
+// Replay datasets recorded by GatherPerTurnReplayStats(), in the order they were first created in
+enum BuiltInReplayDataSetTypes
+{
+	BUILTIN_REPLAYDATASET_PRODUCTIONPERTURN,
+	BUILTIN_REPLAYDATASET_TOTALGOLD,
+	BUILTIN_REPLAYDATASET_GOLDPERTURN,
+	BUILTIN_REPLAYDATASET_CITYCOUNT,
+	BUILTIN_REPLAYDATASET_TECHSKNOWN,
+	BUILTIN_REPLAYDATASET_SCIENCEPERTURN,
+	BUILTIN_REPLAYDATASET_TOTALCULTURE,
+	BUILTIN_REPLAYDATASET_CULTUREPERTURN,
+	BUILTIN_REPLAYDATASET_EXCESSHAPINESS,
+	BUILTIN_REPLAYDATASET_HAPPINESS,
+	BUILTIN_REPLAYDATASET_UNHAPPINESS,
+	BUILTIN_REPLAYDATASET_GOLDENAGETURNS,
+	BUILTIN_REPLAYDATASET_POPULATION,
+	BUILTIN_REPLAYDATASET_FOODPERTURN,
+	BUILTIN_REPLAYDATASET_TOTALLAND,
+	BUILTIN_REPLAYDATASET_GPTCITYCONNECTIONS,
+	BUILTIN_REPLAYDATASET_GPTINTERNATIONALTRADE,
+	BUILTIN_REPLAYDATASET_GPTDEALS,
+	BUILTIN_REPLAYDATASET_UNITMAINTENANCE,
+	BUILTIN_REPLAYDATASET_BUILDINGMAINTENANCE,
+	BUILTIN_REPLAYDATASET_IMPROVEMENTMAINTENANCE,
+	BUILTIN_REPLAYDATASET_NUMBEROFPOLICIES,
+	BUILTIN_REPLAYDATASET_NUMBEROFWORKERS,
+	BUILTIN_REPLAYDATASET_IMPROVEDTILES,
+	BUILTIN_REPLAYDATASET_WORKEDTILES,
+	BUILTIN_REPLAYDATASET_MILITARYMIGHT,
+	NUM_BUILTIN_REPLAYDATASETS
+};
+
+const char* const s_aszBuiltInReplayDataSetNames[NUM_BUILTIN_REPLAYDATASETS] =
+{
+	"REPLAYDATASET_PRODUCTIONPERTURN",
+	"REPLAYDATASET_TOTALGOLD",
+	"REPLAYDATASET_GOLDPERTURN",
+	"REPLAYDATASET_CITYCOUNT",
+	"REPLAYDATASET_TECHSKNOWN",
+	"REPLAYDATASET_SCIENCEPERTURN",
+	"REPLAYDATASET_TOTALCULTURE",
+	"REPLAYDATASET_CULTUREPERTURN",
+	"REPLAYDATASET_EXCESSHAPINESS",
+	"REPLAYDATASET_HAPPINESS",
+	"REPLAYDATASET_UNHAPPINESS",
+	"REPLAYDATASET_GOLDENAGETURNS",
+	"REPLAYDATASET_POPULATION",
+	"REPLAYDATASET_FOODPERTURN",
+	"REPLAYDATASET_TOTALLAND",
+	"REPLAYDATASET_GPTCITYCONNECTIONS",
+	"REPLAYDATASET_GPTINTERNATIONALTRADE",
+	"REPLAYDATASET_GPTDEALS",
+	"REPLAYDATASET_UNITMAINTENANCE",
+	"REPLAYDATASET_BUILDINGMAINTENANCE",
+	"REPLAYDATASET_IMPROVEMENTMAINTENANCE",
+	"REPLAYDATASET_NUMBEROFPOLICIES",
+	"REPLAYDATASET_NUMBEROFWORKERS",
+	"REPLAYDATASET_IMPROVEDTILES",
+	"REPLAYDATASET_WORKEDTILES",
+	"REPLAYDATASET_MILITARYMIGHT"
+};
+}
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
+
 //------------------------------------------------------------------------------
 void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 {
@@ -24970,6 +25367,132 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 		LuaSupport::CallHook(pkScriptSystem, "GatherPerTurnReplayStats", args.get(), bResult);
 	}
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	//Only record the following statistics if the player is alive.
+	if(isAlive())
+	{
+		// Resolve the dataset indices once, in the order the datasets were originally created in
+		if(m_auiBuiltInReplayDataSets.empty())
+		{
+			m_auiBuiltInReplayDataSets.reserve(NUM_BUILTIN_REPLAYDATASETS);
+			for(int iI = 0; iI < NUM_BUILTIN_REPLAYDATASETS; iI++)
+			{
+				m_auiBuiltInReplayDataSets.push_back(getReplayDataSetIndex(s_aszBuiltInReplayDataSetNames[iI]));
+			}
+		}
+		const std::vector<unsigned int>& auiDataSets = m_auiBuiltInReplayDataSets;
+
+		// City yields in a single pass
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+		int aiTotalYields[NUM_YIELD_TYPES];
+		calculateTotalYields(aiTotalYields, (1 << YIELD_PRODUCTION) | (1 << YIELD_GOLD) | (1 << YIELD_SCIENCE) | (1 << YIELD_FOOD));
+		const int iProduction = aiTotalYields[YIELD_PRODUCTION];
+		const int iGold = aiTotalYields[YIELD_GOLD];
+		const int iScience = aiTotalYields[YIELD_SCIENCE];
+		const int iFood = aiTotalYields[YIELD_FOOD];
+#else
+		int iProductionTimes100 = 0;
+		int iGoldTimes100 = 0;
+		int iScienceTimes100 = 0;
+		int iFoodTimes100 = 0;
+		const CvCity* pLoopCity;
+		int iLoopCity;
+		for(pLoopCity = firstCity(&iLoopCity); pLoopCity != NULL; pLoopCity = nextCity(&iLoopCity))
+		{
+			iProductionTimes100 += pLoopCity->getYieldRateTimes100(YIELD_PRODUCTION, false);
+			iGoldTimes100 += pLoopCity->getYieldRateTimes100(YIELD_GOLD, false);
+			iScienceTimes100 += pLoopCity->getYieldRateTimes100(YIELD_SCIENCE, false);
+			iFoodTimes100 += pLoopCity->getYieldRateTimes100(YIELD_FOOD, false);
+		}
+		const int iProduction = iProductionTimes100 / 100;
+		const int iGold = iGoldTimes100 / 100;
+		const int iScience = iScienceTimes100 / 100;
+		const int iFood = iFoodTimes100 / 100;
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
+
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_PRODUCTIONPERTURN], iGameTurn, iProduction);
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_TOTALGOLD], iGameTurn, GetTreasury()->GetGold());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_GOLDPERTURN], iGameTurn, iGold);
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_CITYCOUNT], iGameTurn, getNumCities());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_TECHSKNOWN], iGameTurn, GET_TEAM(getTeam()).GetTeamTechs()->GetNumTechsKnown());
+		// antonjs: This data is also used to calculate Great Scientist and Research Agreement beaker bonuses. If replay data changes
+		// or is disabled, CvPlayer::GetScienceYieldFromPreviousTurns must also change.
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_SCIENCEPERTURN], iGameTurn, iScience);
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_TOTALCULTURE], iGameTurn, getJONSCulture());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_CULTUREPERTURN], iGameTurn, GetTotalJONSCulturePerTurn());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_EXCESSHAPINESS], iGameTurn, GetExcessHappiness());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_HAPPINESS], iGameTurn, GetHappiness());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_UNHAPPINESS], iGameTurn, GetUnhappiness());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_GOLDENAGETURNS], iGameTurn, getGoldenAgeTurns());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_POPULATION], iGameTurn, getTotalPopulation());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_FOODPERTURN], iGameTurn, iFood);
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_TOTALLAND], iGameTurn, getTotalLand());
+
+		CvTreasury* pkTreasury = GetTreasury();
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_GPTCITYCONNECTIONS], iGameTurn, pkTreasury->GetCityConnectionGold());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_GPTINTERNATIONALTRADE], iGameTurn, pkTreasury->GetGoldPerTurnFromTradeRoutes());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_GPTDEALS], iGameTurn, pkTreasury->GetGoldPerTurnFromDiplomacy());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_UNITMAINTENANCE], iGameTurn, pkTreasury->GetExpensePerTurnUnitMaintenance());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_BUILDINGMAINTENANCE], iGameTurn, pkTreasury->GetBuildingGoldMaintenance());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_IMPROVEMENTMAINTENANCE], iGameTurn, pkTreasury->GetImprovementGoldMaintenance());
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_NUMBEROFPOLICIES], iGameTurn, GetPlayerPolicies()->GetNumPoliciesOwned());
+
+		// workers
+		int iWorkerCount = 0;
+		CvUnit* pLoopUnit;
+		int iLoopUnit;
+		for(pLoopUnit = firstUnit(&iLoopUnit); pLoopUnit != NULL; pLoopUnit = nextUnit(&iLoopUnit))
+		{
+			if(pLoopUnit->AI_getUnitAIType() == UNITAI_WORKER)
+			{
+				iWorkerCount++;
+			}
+		}
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_NUMBEROFWORKERS], iGameTurn, iWorkerCount);
+
+		// go through all the plots the player has under their control
+		CvPlotsVector& aiPlots = GetPlots();
+
+		// worked tiles
+		int iWorkedTiles = 0;
+		int iImprovedTiles = 0;
+		for(uint uiPlotIndex = 0; uiPlotIndex < aiPlots.size(); uiPlotIndex++)
+		{
+			// when we encounter the first plot that is invalid, the rest of the list will be invalid
+			if(aiPlots[uiPlotIndex] == -1)
+			{
+				break;
+			}
+
+			CvPlot* pPlot = GC.getMap().plotByIndex(aiPlots[uiPlotIndex]);
+			if(!pPlot)
+			{
+				continue;
+			}
+
+			// plot has city in it, don't count
+			if(pPlot->getPlotCity())
+			{
+				continue;
+			}
+
+			if(pPlot->isBeingWorked())
+			{
+				iWorkedTiles++;
+			}
+
+			if(pPlot->getImprovementType() != NO_IMPROVEMENT)
+			{
+				iImprovedTiles++;
+			}
+		}
+
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_IMPROVEDTILES], iGameTurn, iImprovedTiles);
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_WORKEDTILES], iGameTurn, iWorkedTiles);
+
+		setReplayDataValue(auiDataSets[BUILTIN_REPLAYDATASET_MILITARYMIGHT], iGameTurn, GetMilitaryMight());
+	}
+#else
 	//Only record the following statistics if the player is alive.
 	if(isAlive())
 	{
@@ -25081,6 +25604,7 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 
 		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_MILITARYMIGHT"), iGameTurn, GetMilitaryMight());
 	}
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 }
 
 //	---------------------------------------------------------------------------
@@ -258,6 +258,9 @@ public:
 	void ChangeAllFeatureProduction(int iChange);
 
 	int calculateTotalYield(YieldTypes eYield) const;
+#ifdef AUI_PLAYER_BATCHED_TOTAL_YIELDS
+	void calculateTotalYields(int* aiTotalYields, uint uiYieldMask = ~0u) const;
+#endif // AUI_PLAYER_BATCHED_TOTAL_YIELDS
 
 	int GetUnitProductionMaintenanceMod() const;
 	void UpdateUnitProductionMaintenanceMod();
@@ -898,6 +901,11 @@ public:
 	int GetMilitaryMight() const;
 	int GetEconomicMight() const;
 	int calculateMilitaryMight() const;
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	int GetUnitMilitaryMight() const;
+	void ChangeUnitMilitaryMight(int iChange);
+	void RecalculateUnitMilitaryMight();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 	int calculateEconomicMight() const;
 	int calculateProductionMight() const;
 
@@ -1149,6 +1157,12 @@ public:
 	int getBuildingClassCount(BuildingClassTypes eIndex) const;
 	bool isBuildingClassMaxedOut(BuildingClassTypes eIndex, int iExtra = 0) const;
 	void changeBuildingClassCount(BuildingClassTypes eIndex, int iChange);
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	int GetNumBuildingsWithFlag(BuildingFlagTypes eFlag) const;
+	bool HasBuildingWithFlag(BuildingFlagTypes eFlag) const;
+	void ChangeNumBuildingsWithFlags(uint uiFlags, int iChange);
+	void RecalculateBuildingFlagCounts();
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 	int getBuildingClassMaking(BuildingClassTypes eIndex) const;
 	void changeBuildingClassMaking(BuildingClassTypes eIndex, int iChange);
 	int getBuildingClassCountPlusMaking(BuildingClassTypes eIndex) const;
@@ -1252,7 +1266,11 @@ public:
 	unsigned int getReplayDataSetIndex(const char* szDataSetName);
 	int getReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn) const;
 	void setReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn, int iValue);
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	const TurnData& getReplayDataHistory(unsigned int uiDataSet) const;
+#else
 	TurnData getReplayDataHistory(unsigned int uiDataSet) const;
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 
 	// Arbitrary Script Data
 	std::string getScriptData() const;
@@ -1716,6 +1734,10 @@ protected:
 	FAutoVariable<int, CvPlayer> m_iMilitaryMight;
 	FAutoVariable<int, CvPlayer> m_iEconomicMight;
 	FAutoVariable<int, CvPlayer> m_iTurnMightRecomputed;
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	// Not serialized, rebuilt from the player's units on load
+	int m_iUnitMilitaryMight;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 	FAutoVariable<int, CvPlayer> m_iNewCityExtraPopulation;
 	FAutoVariable<int, CvPlayer> m_iFreeFoodBox;
 	FAutoVariable<int, CvPlayer> m_iScenarioScore1;
@@ -1834,6 +1856,11 @@ protected:
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiUnitClassMaking;
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiBuildingClassCount;
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiBuildingClassMaking;
+#ifdef AUI_PLAYER_BUILDING_FLAG_COUNTS
+	// Not serialized, rebuilt from the player's cities on load
+	int m_aiNumBuildingsWithFlag[NUM_BUILDING_FLAG_TYPES];
+	uint m_uiOwnedBuildingFlags;
+#endif // AUI_PLAYER_BUILDING_FLAG_COUNTS
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiProjectMaking;
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiHurryCount;
 	FAutoVariable<std::vector<int>, CvPlayer> m_paiHurryModifier;
@@ -1876,6 +1903,9 @@ protected:
 
 	std::vector<CvString> m_ReplayDataSets;
 	std::vector< TurnData > m_ReplayDataSetValues;
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+	std::vector<unsigned int> m_auiBuiltInReplayDataSets; // not serialized, indices into m_ReplayDataSets of the stats recorded by GatherPerTurnReplayStats()
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 
 	void doResearch();
 	void doWarnings();
@@ -85,6 +85,11 @@ void CvPlayerAI::AI_uninit()
 void CvPlayerAI::AI_reset()
 {
 	AI_uninit();
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	m_iFoundValueUpdateStamp = -1;
+	m_uiFoundValueInputsChecksum = 0;
+	m_iLastFullFoundValueUpdateTurn = -1;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 }
 
 void CvPlayerAI::AI_doTurnPre()
@@ -182,19 +187,48 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc)
 		{
 			GC.getMap().plotByIndexUnchecked(iI)->setFoundValue(eID, -1);
 		}
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		m_iFoundValueUpdateStamp = -1;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 	}
 	else
 	{
 		const TeamTypes eTeam = getTeam();
 		GC.getGame().GetSettlerSiteEvaluator()->ComputeFlavorMultipliers(this);
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		// Only plots whose surroundings changed since our last update need a rescan, unless some player-wide input changed
+		CvMap& kMap = GC.getMap();
+		const int iGameTurn = GC.getGame().getGameTurn();
+		const uint uiInputsChecksum = GC.getGame().GetSettlerSiteEvaluator()->GetPlayerInputsChecksum(this);
+		const bool bFullUpdate = (m_iFoundValueUpdateStamp < 0 || uiInputsChecksum != m_uiFoundValueInputsChecksum ||
+			iGameTurn - m_iLastFullFoundValueUpdateTurn >= AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES_FULL_REFRESH_INTERVAL || iGameTurn < m_iLastFullFoundValueUpdateTurn);
+		const int iLastUpdateStamp = m_iFoundValueUpdateStamp;
+		m_iFoundValueUpdateStamp = kMap.GetLatestFoundValueDirtyStamp();
+		m_uiFoundValueInputsChecksum = uiInputsChecksum;
+		if (bFullUpdate)
+			m_iLastFullFoundValueUpdateTurn = iGameTurn;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		for (int iI = 0; iI < iNumPlots; iI++)
 		{
 			CvPlot* pLoopPlot = GC.getMap().plotByIndexUnchecked(iI);
 
 			if (pLoopPlot->isRevealed(eTeam))
 			{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+				int iValue;
+				if (bFullUpdate || kMap.GetFoundValueDirtyStamp(iI) > iLastUpdateStamp)
+				{
+					iValue = GC.getGame().GetSettlerSiteEvaluator()->PlotFoundValue(pLoopPlot, this, NO_YIELD, false);
+					pLoopPlot->setFoundValue(eID, iValue);
+				}
+				else
+				{
+					iValue = pLoopPlot->getFoundValue(eID);
+				}
+#else
 				const int iValue = GC.getGame().GetSettlerSiteEvaluator()->PlotFoundValue(pLoopPlot, this, NO_YIELD, false);
 				pLoopPlot->setFoundValue(eID, iValue);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 				if (iValue >= iGoodEnoughToBeWorthOurTime)
 				{
 					CvArea* pLoopArea = GC.getMap().getArea(pLoopPlot->getArea());
@@ -1049,6 +1083,10 @@ void CvPlayerAI::Read(FDataStream& kStream)
 	// Version number to maintain backwards compatibility
 	uint uiVersion;
 	kStream >> uiVersion;
+
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	m_iFoundValueUpdateStamp = -1;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 }
 
 
@@ -98,6 +98,13 @@ protected:
 	static CvPlayerAI* m_aPlayers;
 
 	void AI_doResearch();
+
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	// Not serialized, the first update after a load is always a full one
+	int m_iFoundValueUpdateStamp;
+	uint m_uiFoundValueInputsChecksum;
+	int m_iLastFullFoundValueUpdateTurn;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 };
 
 // helper for accessing static functions
@@ -49,8 +49,14 @@
 //	 * Improvement Revealed array is now hashed
 // Version 7
 //   * Added m_eImprovementTypeUnderConstruction variable to be serialized
+// Version 8
+//   * Feature, resource and improvement types are written as dense indices against the type dictionaries of CvMap
 //------------------------------------------------------------------------------
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+const int g_CurrentCvPlotVersion = 8;
+#else
 const int g_CurrentCvPlotVersion = 7;
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 //	--------------------------------------------------------------------------------
 namespace FSerialization
@@ -191,6 +197,9 @@ void CvPlot::uninit()
 	SAFE_DELETE_ARRAY(m_paiBuildProgress);
 
 	m_units.clear();
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	m_eUnitsSoleOwner = NO_PLAYER;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 }
 
 //	--------------------------------------------------------------------------------
@@ -240,6 +249,9 @@ void CvPlot::reset(int iX, int iY, bool bConstructorCall)
 	m_eOwner = NO_PLAYER;
 	m_ePlotType = PLOT_OCEAN;
 	m_eTerrainType = NO_TERRAIN;
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	m_eUnitsSoleOwner = NO_PLAYER;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 	m_eFeatureType = NO_FEATURE;
 	m_eResourceType = NO_RESOURCE;
 	m_eImprovementType = NO_IMPROVEMENT;
@@ -2719,6 +2731,11 @@ const UnitHandle CvPlot::getBestDefender(PlayerTypes eOwner, PlayerTypes eAttack
 	const UnitHandle pLoopUnit;
 	const UnitHandle pBestUnit;
 
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	if(eOwner != NO_PLAYER && hasOnlyUnitsOfOtherPlayer(eOwner))
+		return pBestUnit;
+
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 	pUnitNode = headUnitNode();
 
 	while(pUnitNode != NULL)
@@ -3620,6 +3637,11 @@ bool CvPlot::isVisibleEnemyDefender(const CvUnit* pUnit) const
 	{
 		TeamTypes eTeam = GET_PLAYER(pUnit->getOwner()).getTeam();
 		bool bAlwaysHostile = pUnit->isAlwaysHostile(*this);
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return false;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 		do
 		{
@@ -3647,6 +3669,11 @@ CvUnit* CvPlot::getVisibleEnemyDefender(PlayerTypes ePlayer)
 	if(pUnitNode)
 	{
 		TeamTypes eTeam = GET_PLAYER(ePlayer).getTeam();
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return NULL;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 		do
 		{
 			const CvUnit* pLoopUnit = GetPlayerUnit(*pUnitNode);
@@ -3673,6 +3700,10 @@ int CvPlot::getNumDefenders(PlayerTypes ePlayer) const
 	if(pUnitNode != NULL)
 	{
 		CvAssertMsg(ePlayer != NO_PLAYER, "Player must be valid");
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		if(hasOnlyUnitsOfOtherPlayer(ePlayer))
+			return 0;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 		int iCount = 0;
 
 		do
@@ -3704,6 +3735,11 @@ int CvPlot::getNumVisibleEnemyDefenders(const CvUnit* pUnit) const
 	{
 		TeamTypes eTeam = GET_PLAYER(pUnit->getOwner()).getTeam();
 		bool bAlwaysHostile = pUnit->isAlwaysHostile(*this);
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return 0;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 		int iCount = 0;
 
 		do
@@ -3735,6 +3771,11 @@ int CvPlot::getNumVisiblePotentialEnemyDefenders(const CvUnit* pUnit) const
 		int iCount = 0;
 		TeamTypes eTeam = GET_PLAYER(pUnit->getOwner()).getTeam();
 		bool bAlwaysHostile = pUnit->isAlwaysHostile(*this);
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return 0;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 		do
 		{
@@ -3764,6 +3805,11 @@ bool CvPlot::isVisibleEnemyUnit(PlayerTypes ePlayer) const
 	if(pUnitNode)
 	{
 		TeamTypes eTeam = GET_PLAYER(ePlayer).getTeam();
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return false;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 		do
 		{
@@ -3793,6 +3839,11 @@ bool CvPlot::isVisibleEnemyUnit(const CvUnit* pUnit) const
 	{
 		TeamTypes eTeam = GET_PLAYER(pUnit->getOwner()).getTeam();
 		bool bAlwaysHostile = pUnit->isAlwaysHostile(*this);
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Nothing on this plot that could be hostile to us
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return false;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 		do
 		{
@@ -3821,6 +3872,11 @@ bool CvPlot::isVisibleOtherUnit(PlayerTypes ePlayer) const
 	if(pUnitNode)
 	{
 		TeamTypes eTeam = GET_PLAYER(ePlayer).getTeam();
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+		// Every unit on this plot is on our team
+		if(hasOnlyUnitsOfTeam(eTeam))
+			return false;
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 		do
 		{
@@ -4569,6 +4625,10 @@ void CvPlot::setNEOfRiver(bool bNewValue, FlowDirectionTypes eRiverDir)
 		CvAssertMsg(m_eRiverSWFlowDirection == NO_FLOWDIRECTION && eRiverDir != NO_FLOWDIRECTION, "invalid parameter");
 		if(isNEOfRiver() != bNewValue)
 		{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+			// River state of this plot and its neighbors changes
+			GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES + 1);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 			m_bNEOfRiver = bNewValue;
 
 			updateRiverCrossing();
@@ -4615,6 +4675,10 @@ void CvPlot::setWOfRiver(bool bNewValue, FlowDirectionTypes eRiverDir)
 		CvAssertMsg(m_eRiverEFlowDirection == NO_FLOWDIRECTION && eRiverDir != NO_FLOWDIRECTION, "invalid parameter");
 		if(isWOfRiver() != bNewValue)
 		{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+			// River state of this plot and its neighbors changes
+			GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES + 1);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 			m_bWOfRiver = bNewValue;
 
 			updateRiverCrossing();
@@ -4661,6 +4725,10 @@ void CvPlot::setNWOfRiver(bool bNewValue, FlowDirectionTypes eRiverDir)
 		CvAssertMsg(m_eRiverSEFlowDirection == NO_FLOWDIRECTION && eRiverDir != NO_FLOWDIRECTION, "invalid parameter");
 		if(isNWOfRiver() != bNewValue)
 		{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+			// River state of this plot and its neighbors changes
+			GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES + 1);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 			m_bNWOfRiver = bNewValue;
 
 			updateRiverCrossing();
@@ -4852,6 +4920,9 @@ void CvPlot::setOwner(PlayerTypes eNewValue, int iAcquiringCityID, bool bCheckUn
 	// Remove effects for old owner before changing the member
 	if(getOwner() != eNewValue)
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		PlayerTypes eOldOwner = getOwner();;
 
 		GC.getGame().addReplayMessage(REPLAY_MESSAGE_PLOT_OWNER_CHANGE, eNewValue, "", getX(), getY());
@@ -5286,6 +5357,11 @@ bool CvPlot::IsHomeFrontForPlayer(PlayerTypes ePlayer) const
 		}
 	}
 
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	GC.getMap().ValidateHomeFrontCounts();
+	return (m_aiPlayerHomeFrontCount[ePlayer] > 0);
+#else
+
 	CvCity* pLoopCity;
 	int iCityLoop;
 
@@ -5301,6 +5377,7 @@ bool CvPlot::IsHomeFrontForPlayer(PlayerTypes ePlayer) const
 	}
 
 	return false;
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 }
 
 //	--------------------------------------------------------------------------------
@@ -5338,6 +5415,9 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 
 	if(getPlotType() != eNewValue)
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		if((getPlotType() == PLOT_OCEAN) || (eNewValue == PLOT_OCEAN))
 		{
 			erase(bEraseUnitsIfWater);
@@ -5569,6 +5649,9 @@ void CvPlot::setTerrainType(TerrainTypes eNewValue, bool bRecalculate, bool bReb
 
 	if(getTerrainType() != eNewValue)
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		if((getTerrainType() != NO_TERRAIN) &&
 		        (eNewValue != NO_TERRAIN) &&
 		        ((GC.getTerrainInfo(getTerrainType())->getSeeFromLevel() != GC.getTerrainInfo(eNewValue)->getSeeFromLevel()) ||
@@ -5616,6 +5699,9 @@ void CvPlot::setFeatureType(FeatureTypes eNewValue, int iVariety)
 
 	if((eOldFeature != eNewValue) || (m_iFeatureVariety != iVariety))
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		if((eOldFeature == NO_FEATURE) ||
 		        (eNewValue == NO_FEATURE) ||
 		        (GC.getFeatureInfo(eOldFeature)->getSeeThroughChange() != GC.getFeatureInfo(eNewValue)->getSeeThroughChange()))
@@ -5770,6 +5856,9 @@ void CvPlot::setResourceType(ResourceTypes eNewValue, int iResourceNum, bool bFo
 				}
 			}
 		}
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 
 		if(m_eResourceType != NO_RESOURCE)
 		{
@@ -5970,6 +6059,12 @@ void CvPlot::setImprovementType(ImprovementTypes eNewValue, PlayerTypes eBuilder
 
 	if(eOldImprovement != eNewValue)
 	{
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+		CvUnit::DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		PlayerTypes owningPlayerID = getOwner();
 		if(eOldImprovement != NO_IMPROVEMENT)
 		{
@@ -6393,6 +6488,9 @@ void CvPlot::setRouteType(RouteTypes eNewValue)
 
 	if(eOldRoute != eNewValue || (eOldRoute == eNewValue && IsRoutePillaged()))
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		bOldRoute = isRoute(); // XXX is this right???
 
 		// Remove old effects
@@ -6728,6 +6826,9 @@ void CvPlot::setPlotCity(CvCity* pNewValue)
 
 	if(getPlotCity() != pNewValue)
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 		if(isCity())
 		{
 			// Is a route is here?  If so, we may now need to pay maintenance for it.  Yes, yes, I know, we're removing a city
@@ -6752,6 +6853,9 @@ void CvPlot::setPlotCity(CvCity* pNewValue)
 					pLoopPlot->changePlayerCityRadiusCount(getPlotCity()->getOwner(), -1);
 				}
 			}
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+			GC.getMap().ChangeHomeFrontCounts(this, getPlotCity()->getOwner(), -1);
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 		}
 
 		if(pNewValue != NULL)
@@ -6775,6 +6879,9 @@ void CvPlot::setPlotCity(CvCity* pNewValue)
 					pLoopPlot->changePlayerCityRadiusCount(getPlotCity()->getOwner(), 1);
 				}
 			}
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+			GC.getMap().ChangeHomeFrontCounts(this, getPlotCity()->getOwner(), 1);
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 
 			// Is a route is here?  If we already owned this plot, then we were paying maintenance, now we don't have to.
 			if(getRouteType() != NO_ROUTE && getPlotCity()->getOwner() == getOwner())
@@ -8250,6 +8357,10 @@ bool CvPlot::setRevealed(TeamTypes eTeam, bool bNewValue, bool bTerrainOnly, Tea
 	bool bVisbilityUpdated = false;
 	if(isRevealed(eTeam) != bNewValue)
 	{
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+		// The found value scan reads the reveal state of every plot in range, so every site within range of this plot changes
+		GC.getMap().DirtyFoundValues(getX(), getY(), AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES);
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 
 		m_bfRevealed.ToggleBit(eTeam);
 
@@ -9332,6 +9443,9 @@ void CvPlot::addUnit(CvUnit* pUnit, bool bUpdate)
 		IDInfo unitIDInfo = pUnit->GetIDInfo();
 		m_units.insertAtEnd(&unitIDInfo);
 	}
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	updateUnitsSoleOwner();
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 	if(bUpdate)
 	{
@@ -9360,6 +9474,9 @@ void CvPlot::removeUnit(CvUnit* pUnit, bool bUpdate)
 			pUnitNode = nextUnitNode(pUnitNode);
 		}
 	}
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	updateUnitsSoleOwner();
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 	GC.getMap().plotManager().RemoveUnit(pUnit->GetIDInfo(), m_iX, m_iY, -1);
 
@@ -9369,6 +9486,45 @@ void CvPlot::removeUnit(CvUnit* pUnit, bool bUpdate)
 	}
 }
 
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+//	--------------------------------------------------------------------------------
+/// Only looks at the owners stored in the unit list, so units never have to be resolved
+void CvPlot::updateUnitsSoleOwner()
+{
+	const IDInfo* pUnitNode = m_units.head();
+	if(pUnitNode == NULL)
+	{
+		m_eUnitsSoleOwner = NO_PLAYER;
+		return;
+	}
+
+	PlayerTypes eOwner = pUnitNode->eOwner;
+	for(pUnitNode = m_units.next(pUnitNode); pUnitNode != NULL; pUnitNode = m_units.next(pUnitNode))
+	{
+		if(pUnitNode->eOwner != eOwner)
+		{
+			eOwner = NO_PLAYER;
+			break;
+		}
+	}
+	m_eUnitsSoleOwner = eOwner;
+}
+
+//	--------------------------------------------------------------------------------
+/// Do all units on this plot belong to a single player on this team?
+bool CvPlot::hasOnlyUnitsOfTeam(TeamTypes eTeam) const
+{
+	return m_eUnitsSoleOwner != NO_PLAYER && GET_PLAYER((PlayerTypes)m_eUnitsSoleOwner).getTeam() == eTeam;
+}
+
+//	--------------------------------------------------------------------------------
+/// Do all units on this plot belong to a single player other than this one?
+bool CvPlot::hasOnlyUnitsOfOtherPlayer(PlayerTypes ePlayer) const
+{
+	return m_eUnitsSoleOwner != NO_PLAYER && m_eUnitsSoleOwner != ePlayer;
+}
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
+
 //	--------------------------------------------------------------------------------
 const IDInfo* CvPlot::nextUnitNode(const IDInfo* pNode) const
 {
@@ -9585,7 +9741,11 @@ void CvPlot::processArea(CvArea* pArea, int iChange)
 // read object from a stream
 // used during load
 //
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+void CvPlot::read(FDataStream& kStream, uint uiColumnarVersion)
+#else
 void CvPlot::read(FDataStream& kStream)
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 {
 	int iCount;
 
@@ -9594,6 +9754,13 @@ void CvPlot::read(FDataStream& kStream)
 
 	// Version number to maintain backwards compatibility
 	uint uiVersion;
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	// When reading columnar, the version is stored once by readColumnar() and the columnar fields are read after all plots
+	bool bColumnar = (uiColumnarVersion != 0);
+	if (bColumnar)
+		uiVersion = uiColumnarVersion;
+	else
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream >> uiVersion;
 	CvAssertMsg(uiVersion <= g_CurrentCvPlotVersion, "Unexpected Version.  This could be caused by serialization errors.");
 
@@ -9645,9 +9812,25 @@ void CvPlot::read(FDataStream& kStream)
 	kStream >> bitPackWorkaround;
 	m_bImprovedByGiftFromMajor = bitPackWorkaround;
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+	{
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream >> m_eOwner;
 	kStream >> m_ePlotType;
 	kStream >> m_eTerrainType;
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	// Dense indices are remapped through the type dictionaries read by CvMap::Read()
+	if (uiVersion >= 8)
+	{
+		m_eFeatureType = (FeatureTypes) CvInfosSerializationHelper::ReadDenseType<FeatureTypes>(kStream);
+		m_eResourceType = (ResourceTypes) CvInfosSerializationHelper::ReadDenseType<ResourceTypes>(kStream);
+		m_eImprovementType = (ImprovementTypes) CvInfosSerializationHelper::ReadDenseType<ImprovementTypes>(kStream);
+		m_eImprovementTypeUnderConstruction = (ImprovementTypes) CvInfosSerializationHelper::ReadDenseType<ImprovementTypes>(kStream);
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	if (uiVersion >= 3)
 		m_eFeatureType = (FeatureTypes) CvInfosSerializationHelper::ReadHashed(kStream);
 	else
@@ -9679,6 +9862,12 @@ void CvPlot::read(FDataStream& kStream)
 	{
 		m_eImprovementTypeUnderConstruction = NO_IMPROVEMENT;
 	}
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 
 	if (uiVersion >= 2)
 	{
@@ -9691,6 +9880,9 @@ void CvPlot::read(FDataStream& kStream)
 	kStream >> m_ePlayerResponsibleForImprovement;
 	kStream >> m_ePlayerResponsibleForRoute;
 	kStream >> m_ePlayerThatClearedBarbCampHere;
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream >> m_eRouteType;
 	kStream >> m_eWorldAnchor;
 	kStream >> m_cWorldAnchorData;
@@ -9713,6 +9905,10 @@ void CvPlot::read(FDataStream& kStream)
 	for(uint i = 0; i < NUM_YIELD_TYPES; i++)
 		kStream >> m_aiYield[i];
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+	{
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	for(uint i = 0; i < REALLY_MAX_PLAYERS; i++)
 		kStream >> m_aiFoundValue[i];
 
@@ -9739,6 +9935,14 @@ void CvPlot::read(FDataStream& kStream)
 	for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
 		kStream >> m_abResourceForceReveal[i];
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (uiVersion >= 8)
+	{
+		for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
+			m_aeRevealedImprovementType[i] = (ImprovementTypes) CvInfosSerializationHelper::ReadDenseType<ImprovementTypes>(kStream);
+	}
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	if (uiVersion >= 6)
 	{
 		for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
@@ -9757,6 +9961,9 @@ void CvPlot::read(FDataStream& kStream)
 
 	for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
 		kStream >> m_aeRevealedRouteType[i];
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 
 	for(uint i = 0; i < MAX_MAJOR_CIVS; i++)
 		kStream >> m_abNoSettling[i];
@@ -9795,10 +10002,17 @@ void CvPlot::read(FDataStream& kStream)
 
 		m_units.insertAtEnd(&Data);
 	}
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	updateUnitsSoleOwner();
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 	kStream >> m_cContinentType;
 	kStream >> m_kArchaeologyData;
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	// Terrain and feature are not known yet, readColumnar() updates impassability once the columns are in
+	if (!bColumnar)
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	updateImpassable();
 }
 
@@ -9807,10 +10021,17 @@ void CvPlot::read(FDataStream& kStream)
 // write object to a stream
 // used during save
 //
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+void CvPlot::write(FDataStream& kStream, bool bColumnar) const
+#else
 void CvPlot::write(FDataStream& kStream) const
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 {
 	// Current version number
 	uint uiVersion = g_CurrentCvPlotVersion;
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream << uiVersion;
 
 	kStream << m_iX;
@@ -9848,17 +10069,34 @@ void CvPlot::write(FDataStream& kStream) const
 	// m_bPlotLayoutDirty not saved
 	// m_bLayoutStateWorked not saved
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+	{
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream << m_eOwner;
 	kStream << m_ePlotType;
 	kStream << m_eTerrainType;
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseType(kStream, (int)m_eFeatureType.get());
+	CvInfosSerializationHelper::WriteDenseType(kStream, (int)m_eResourceType);
+	CvInfosSerializationHelper::WriteDenseType(kStream, (int)m_eImprovementType);
+	CvInfosSerializationHelper::WriteDenseType(kStream, (int)m_eImprovementTypeUnderConstruction);
+#else
 	CvInfosSerializationHelper::WriteHashed(kStream, (const FeatureTypes)m_eFeatureType.get());
 	CvInfosSerializationHelper::WriteHashed(kStream, (const ResourceTypes)m_eResourceType);
 	CvInfosSerializationHelper::WriteHashed(kStream, (const ImprovementTypes)m_eImprovementType);
 	CvInfosSerializationHelper::WriteHashed(kStream, (const ImprovementTypes)m_eImprovementTypeUnderConstruction);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream << m_ePlayerBuiltImprovement;
 	kStream << m_ePlayerResponsibleForImprovement;
 	kStream << m_ePlayerResponsibleForRoute;
 	kStream << m_ePlayerThatClearedBarbCampHere;
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	kStream << m_eRouteType;
 	kStream << m_eWorldAnchor;
 	kStream << m_cWorldAnchorData;
@@ -9880,6 +10118,10 @@ void CvPlot::write(FDataStream& kStream) const
 	for(uint i = 0; i < NUM_YIELD_TYPES; i++)
 		kStream << m_aiYield[i];
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	if (!bColumnar)
+	{
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 	for(uint i = 0; i < REALLY_MAX_PLAYERS; i++)
 		kStream << m_aiFoundValue[i];
 
@@ -9907,11 +10149,18 @@ void CvPlot::write(FDataStream& kStream) const
 
 	for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
 	{
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+		CvInfosSerializationHelper::WriteDenseType(kStream, (int)m_aeRevealedImprovementType[i]);
+#else
 		CvInfosSerializationHelper::WriteHashed(kStream, (const ImprovementTypes)m_aeRevealedImprovementType[i]);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	}
 
 	for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
 		kStream << m_aeRevealedRouteType[i];
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 
 	for(uint i = 0; i < MAX_MAJOR_CIVS; i++)
 		kStream << m_abNoSettling[i];
@@ -9952,6 +10201,275 @@ void CvPlot::write(FDataStream& kStream) const
 	kStream << m_kArchaeologyData;
 }
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+//	--------------------------------------------------------------------------------
+/// Writes a column of plot data with a single WriteIt, or as runs of equal values if that is smaller (sparse columns)
+template<typename T>
+static void WritePlotColumn(FDataStream& kStream, const T* paColumn, uint uiCount)
+{
+	uint uiNumRuns = 0;
+	for(uint uiI = 0; uiI < uiCount; uiI++)
+	{
+		if(uiI == 0 || paColumn[uiI] != paColumn[uiI - 1])
+			uiNumRuns++;
+	}
+
+	bool bRunLength = (uiNumRuns * (sizeof(uint) + sizeof(T)) < uiCount * sizeof(T));
+	kStream << bRunLength;
+	if(bRunLength)
+	{
+		uint* pauiRunLengths = FNEW(uint[uiNumRuns], c_eCiv5GameplayDLL, 0);
+		T* paRunValues = FNEW(T[uiNumRuns], c_eCiv5GameplayDLL, 0);
+		int iRun = -1;
+		for(uint uiI = 0; uiI < uiCount; uiI++)
+		{
+			if(uiI == 0 || paColumn[uiI] != paColumn[uiI - 1])
+			{
+				iRun++;
+				pauiRunLengths[iRun] = 0;
+				paRunValues[iRun] = paColumn[uiI];
+			}
+			pauiRunLengths[iRun]++;
+		}
+
+		kStream << uiNumRuns;
+		kStream.WriteIt(uiNumRuns * sizeof(uint), pauiRunLengths);
+		kStream.WriteIt(uiNumRuns * sizeof(T), paRunValues);
+		SAFE_DELETE_ARRAY(pauiRunLengths);
+		SAFE_DELETE_ARRAY(paRunValues);
+	}
+	else
+	{
+		kStream.WriteIt(uiCount * sizeof(T), paColumn);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Reads a column of plot data written by WritePlotColumn()
+template<typename T>
+static void ReadPlotColumn(FDataStream& kStream, T* paColumn, uint uiCount)
+{
+	bool bRunLength;
+	kStream >> bRunLength;
+	if(bRunLength)
+	{
+		uint uiNumRuns;
+		kStream >> uiNumRuns;
+		uint* pauiRunLengths = FNEW(uint[uiNumRuns], c_eCiv5GameplayDLL, 0);
+		T* paRunValues = FNEW(T[uiNumRuns], c_eCiv5GameplayDLL, 0);
+		kStream.ReadIt(uiNumRuns * sizeof(uint), pauiRunLengths);
+		kStream.ReadIt(uiNumRuns * sizeof(T), paRunValues);
+
+		uint uiI = 0;
+		for(uint uiRun = 0; uiRun < uiNumRuns; uiRun++)
+		{
+			for(uint uiJ = 0; uiJ < pauiRunLengths[uiRun] && uiI < uiCount; uiJ++)
+			{
+				paColumn[uiI++] = paRunValues[uiRun];
+			}
+		}
+		CvAssertMsg(uiI == uiCount, "Plot column run lengths do not match the number of plots.  This could be caused by serialization errors.");
+
+		SAFE_DELETE_ARRAY(pauiRunLengths);
+		SAFE_DELETE_ARRAY(paRunValues);
+	}
+	else
+	{
+		kStream.ReadIt(uiCount * sizeof(T), paColumn);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Writes one member of every plot as a single column
+template<typename T>
+static void WritePlotMemberColumn(FDataStream& kStream, const CvPlot* pPlots, uint uiNumPlots, T CvPlot::* pMember)
+{
+	T* paColumn = FNEW(T[uiNumPlots], c_eCiv5GameplayDLL, 0);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		paColumn[uiPlot] = pPlots[uiPlot].*pMember;
+	}
+	WritePlotColumn(kStream, paColumn, uiNumPlots);
+	SAFE_DELETE_ARRAY(paColumn);
+}
+
+//	--------------------------------------------------------------------------------
+/// Reads one member of every plot from a single column
+template<typename T>
+static void ReadPlotMemberColumn(FDataStream& kStream, CvPlot* pPlots, uint uiNumPlots, T CvPlot::* pMember)
+{
+	T* paColumn = FNEW(T[uiNumPlots], c_eCiv5GameplayDLL, 0);
+	ReadPlotColumn(kStream, paColumn, uiNumPlots);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		pPlots[uiPlot].*pMember = paColumn[uiPlot];
+	}
+	SAFE_DELETE_ARRAY(paColumn);
+}
+
+//	--------------------------------------------------------------------------------
+/// Writes a per-player or per-team array member of every plot as a single column, with all plots of an entry next to each other
+template<typename T>
+static void WritePlotArrayColumn(FDataStream& kStream, const CvPlot* pPlots, uint uiNumPlots, T* CvPlot::* pMember, uint uiArraySize)
+{
+	T* paColumn = FNEW(T[uiNumPlots * uiArraySize], c_eCiv5GameplayDLL, 0);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		const T* paValues = pPlots[uiPlot].*pMember;
+		for(uint uiI = 0; uiI < uiArraySize; uiI++)
+		{
+			paColumn[uiI * uiNumPlots + uiPlot] = paValues[uiI];
+		}
+	}
+	WritePlotColumn(kStream, paColumn, uiNumPlots * uiArraySize);
+	SAFE_DELETE_ARRAY(paColumn);
+}
+
+//	--------------------------------------------------------------------------------
+/// Reads a per-player or per-team array member of every plot from a single column
+template<typename T>
+static void ReadPlotArrayColumn(FDataStream& kStream, CvPlot* pPlots, uint uiNumPlots, T* CvPlot::* pMember, uint uiArraySize)
+{
+	T* paColumn = FNEW(T[uiNumPlots * uiArraySize], c_eCiv5GameplayDLL, 0);
+	ReadPlotColumn(kStream, paColumn, uiNumPlots * uiArraySize);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		T* paValues = pPlots[uiPlot].*pMember;
+		for(uint uiI = 0; uiI < uiArraySize; uiI++)
+		{
+			paValues[uiI] = paColumn[uiI * uiNumPlots + uiPlot];
+		}
+	}
+	SAFE_DELETE_ARRAY(paColumn);
+}
+
+//	--------------------------------------------------------------------------------
+//
+// write all plots of the map to a stream, the bulk of the per-plot data as columns
+// used during save
+//
+void CvPlot::writeColumnar(FDataStream& kStream, const CvPlot* pPlots, int iNumPlots)
+{
+	// Current version number, shared by all plots
+	uint uiVersion = g_CurrentCvPlotVersion;
+	kStream << uiVersion;
+
+	for(int iI = 0; iI < iNumPlots; iI++)
+	{
+		pPlots[iI].write(kStream, true);
+	}
+
+	const uint uiNumPlots = (uint)iNumPlots;
+
+	// Types are written as their runtime (dense) indices, CvMap::Write() has written the matching type dictionaries
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eOwner);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_ePlotType);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eTerrainType);
+	char* pacFeatures = FNEW(char[uiNumPlots], c_eCiv5GameplayDLL, 0);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		pacFeatures[uiPlot] = pPlots[uiPlot].m_eFeatureType.get();
+	}
+	WritePlotColumn(kStream, pacFeatures, uiNumPlots);
+	SAFE_DELETE_ARRAY(pacFeatures);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eResourceType);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eImprovementType);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eImprovementTypeUnderConstruction);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eRouteType);
+	WritePlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_cRiverCrossing);
+
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiFoundValue, REALLY_MAX_PLAYERS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiPlayerCityRadiusCount, REALLY_MAX_PLAYERS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiVisibilityCount, REALLY_MAX_TEAMS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiRevealedOwner, REALLY_MAX_TEAMS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_abResourceForceReveal, REALLY_MAX_TEAMS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aeRevealedImprovementType, REALLY_MAX_TEAMS);
+	WritePlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aeRevealedRouteType, REALLY_MAX_TEAMS);
+
+	DWORD* padwRevealed = FNEW(DWORD[uiNumPlots * PlotBoolField::eCount], c_eCiv5GameplayDLL, 0);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		for(uint uiI = 0; uiI < PlotBoolField::eCount; uiI++)
+		{
+			padwRevealed[uiI * uiNumPlots + uiPlot] = pPlots[uiPlot].m_bfRevealed.m_dwBits[uiI];
+		}
+	}
+	WritePlotColumn(kStream, padwRevealed, uiNumPlots * PlotBoolField::eCount);
+	SAFE_DELETE_ARRAY(padwRevealed);
+}
+
+//	--------------------------------------------------------------------------------
+//
+// read all plots of the map from a stream written by writeColumnar()
+// used during load
+//
+void CvPlot::readColumnar(FDataStream& kStream, CvPlot* pPlots, int iNumPlots)
+{
+	uint uiVersion;
+	kStream >> uiVersion;
+	CvAssertMsg(uiVersion <= g_CurrentCvPlotVersion, "Unexpected Version.  This could be caused by serialization errors.");
+
+	for(int iI = 0; iI < iNumPlots; iI++)
+	{
+		pPlots[iI].read(kStream, uiVersion);
+	}
+
+	const uint uiNumPlots = (uint)iNumPlots;
+
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eOwner);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_ePlotType);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eTerrainType);
+	char* pacFeatures = FNEW(char[uiNumPlots], c_eCiv5GameplayDLL, 0);
+	ReadPlotColumn(kStream, pacFeatures, uiNumPlots);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		pPlots[uiPlot].m_eFeatureType = (char)CvInfosSerializationHelper::RemapType<FeatureTypes>(pacFeatures[uiPlot]);
+	}
+	SAFE_DELETE_ARRAY(pacFeatures);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eResourceType);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eImprovementType);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eImprovementTypeUnderConstruction);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_eRouteType);
+	ReadPlotMemberColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_cRiverCrossing);
+
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiFoundValue, REALLY_MAX_PLAYERS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiPlayerCityRadiusCount, REALLY_MAX_PLAYERS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiVisibilityCount, REALLY_MAX_TEAMS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aiRevealedOwner, REALLY_MAX_TEAMS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_abResourceForceReveal, REALLY_MAX_TEAMS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aeRevealedImprovementType, REALLY_MAX_TEAMS);
+	ReadPlotArrayColumn(kStream, pPlots, uiNumPlots, &CvPlot::m_aeRevealedRouteType, REALLY_MAX_TEAMS);
+
+	DWORD* padwRevealed = FNEW(DWORD[uiNumPlots * PlotBoolField::eCount], c_eCiv5GameplayDLL, 0);
+	ReadPlotColumn(kStream, padwRevealed, uiNumPlots * PlotBoolField::eCount);
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		for(uint uiI = 0; uiI < PlotBoolField::eCount; uiI++)
+		{
+			pPlots[uiPlot].m_bfRevealed.m_dwBits[uiI] = padwRevealed[uiI * uiNumPlots + uiPlot];
+		}
+	}
+	SAFE_DELETE_ARRAY(padwRevealed);
+
+	// Translate the dense type indices to the currently loaded data
+	for(uint uiPlot = 0; uiPlot < uiNumPlots; uiPlot++)
+	{
+		CvPlot& kPlot = pPlots[uiPlot];
+		kPlot.m_eResourceType = (char)CvInfosSerializationHelper::RemapType<ResourceTypes>(kPlot.m_eResourceType);
+		kPlot.m_eImprovementType = (char)CvInfosSerializationHelper::RemapType<ImprovementTypes>(kPlot.m_eImprovementType);
+		kPlot.m_eImprovementTypeUnderConstruction = (char)CvInfosSerializationHelper::RemapType<ImprovementTypes>(kPlot.m_eImprovementTypeUnderConstruction);
+		for(uint i = 0; i < REALLY_MAX_TEAMS; i++)
+		{
+			kPlot.m_aeRevealedImprovementType[i] = (short)CvInfosSerializationHelper::RemapType<ImprovementTypes>(kPlot.m_aeRevealedImprovementType[i]);
+			if (kPlot.m_aiVisibilityCount[i] < 0)
+				kPlot.m_aiVisibilityCount[i] = 0;
+		}
+
+		kPlot.updateImpassable();
+	}
+}
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+
 //	--------------------------------------------------------------------------------
 void CvPlot::setLayoutDirty(bool bDirty)
 {
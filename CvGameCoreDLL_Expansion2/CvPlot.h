@@ -663,8 +663,15 @@ public:
 
 	bool canTrain(UnitTypes eUnit, bool bContinue, bool bTestVisible) const;
 
+#ifdef AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
+	void read(FDataStream& kStream, uint uiColumnarVersion = 0);
+	void write(FDataStream& kStream, bool bColumnar = false) const;
+	static void readColumnar(FDataStream& kStream, CvPlot* pPlots, int iNumPlots);
+	static void writeColumnar(FDataStream& kStream, const CvPlot* pPlots, int iNumPlots);
+#else
 	void read(FDataStream& kStream);
 	void write(FDataStream& kStream) const;
+#endif // AUI_MAP_COLUMNAR_PLOT_SERIALIZATION
 
 	inline int getScratchPad() const
 	{
@@ -710,6 +717,12 @@ public:
 	bool HasWrittenArtifact() const;
 
 protected:
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	void updateUnitsSoleOwner();
+	bool hasOnlyUnitsOfTeam(TeamTypes eTeam) const;
+	bool hasOnlyUnitsOfOtherPlayer(PlayerTypes ePlayer) const;
+
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 	class PlotBoolField
 	{
 	public:
@@ -764,6 +777,9 @@ protected:
 	char /*PlayerTypes*/  m_eOwner;
 	char /*PlotTypes*/    m_ePlotType;
 	char /*TerrainTypes*/ m_eTerrainType;
+#ifdef AUI_PLOT_UNITS_SOLE_OWNER
+	char /*PlayerTypes*/  m_eUnitsSoleOwner; // not serialized, NO_PLAYER if the plot is empty or has units of several players
+#endif // AUI_PLOT_UNITS_SOLE_OWNER
 
 	PlotBoolField m_bfRevealed;
 
@@ -779,6 +795,9 @@ protected:
 	short* m_aiYield;
 	int* m_aiFoundValue;
 	char* m_aiPlayerCityRadiusCount;
+#ifdef AUI_PLOT_HOME_FRONT_COUNTS
+	char* m_aiPlayerHomeFrontCount; // not serialized, owned by CvMap
+#endif // AUI_PLOT_HOME_FRONT_COUNTS
 	short* m_aiVisibilityCount;
 	char* m_aiRevealedOwner;
 	//bool *m_abRevealed;
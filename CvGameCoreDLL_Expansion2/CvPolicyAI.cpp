@@ -1095,6 +1095,40 @@ int CvPolicyAI::GetNumHappinessPolicies(CvPlayer* pPlayer, PolicyBranchTypes eBr
 void CvPolicyAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 {
 	int iPolicyLoop;
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+	CvPolicyXMLEntries* pkPolicyEntries = m_pCurrentPolicies->GetPolicies();
+
+	// Loop through policies looking for ones that are just getting some new weight
+	for(iPolicyLoop = 0; iPolicyLoop < pkPolicyEntries->GetNumPolicies(); iPolicyLoop++)
+	{
+		int iWeight = paiTempWeights[iPolicyLoop];
+		if(iWeight > 0)
+		{
+			int iNumTerms = 0;
+			const CvPolicyXMLEntries::PrereqWeightTerm* pTerms = pkPolicyEntries->GetPrereqWeightTerms(iPolicyLoop, m_iPolicyWeightPropagationLevels, iNumTerms);
+			int iDepth = 0;
+			bool bExhausted = false;
+			for(int iI = 0; iI < iNumTerms && !bExhausted; iI++)
+			{
+				// Reduce the weight one step at a time so the integer rounding matches the recursion; it stops going deeper once nothing is left
+				while(iDepth < pTerms[iI].m_iDepth)
+				{
+					if(iWeight <= 0)
+					{
+						bExhausted = true;
+						break;
+					}
+					iWeight = iWeight * iPropagationPercent / 100;
+					iDepth++;
+				}
+				if(!bExhausted)
+				{
+					m_PolicyAIWeights.IncreaseWeight(pTerms[iI].m_iPrereq, iWeight * pTerms[iI].m_iCount);
+				}
+			}
+		}
+	}
+#else
 
 	// Loop through policies looking for ones that are just getting some new weight
 	for(iPolicyLoop = 0; iPolicyLoop < m_pCurrentPolicies->GetPolicies()->GetNumPolicies(); iPolicyLoop++)
@@ -1105,6 +1139,7 @@ void CvPolicyAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 			PropagateWeights(iPolicyLoop, paiTempWeights[iPolicyLoop], iPropagationPercent, 0);
 		}
 	}
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
 }
 
 /// Recursive routine to weight all prerequisite policies
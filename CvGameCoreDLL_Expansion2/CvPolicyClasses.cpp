@@ -1901,6 +1901,9 @@ bool CvPolicyBranchEntry::IsDelayWhenNoScience() const
 //=====================================
 /// Constructor
 CvPolicyXMLEntries::CvPolicyXMLEntries(void)
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+	: m_iPrereqWeightTermLevels(-1)
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
 {
 
 }
@@ -1933,6 +1936,11 @@ void CvPolicyXMLEntries::DeletePoliciesArray()
 	}
 
 	m_paPolicyEntries.clear();
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+	m_aPrereqWeightTerms.clear();
+	m_aiPrereqWeightTermStart.clear();
+	m_iPrereqWeightTermLevels = -1;
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
 }
 
 /// Get a specific entry
@@ -1941,6 +1949,74 @@ CvPolicyEntry* CvPolicyXMLEntries::GetPolicyEntry(int index)
 	return m_paPolicyEntries[index];
 }
 
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+/// Flattened prerequisite propagation terms for a policy, sorted by depth (built on first use)
+const CvPolicyXMLEntries::PrereqWeightTerm* CvPolicyXMLEntries::GetPrereqWeightTerms(int iPolicy, int iPropagationLevels, int& iNumTerms)
+{
+	if(m_iPrereqWeightTermLevels != iPropagationLevels || (int)m_aiPrereqWeightTermStart.size() != GetNumPolicies() + 1)
+	{
+		BuildPrereqWeightTerms(iPropagationLevels);
+	}
+
+	iNumTerms = m_aiPrereqWeightTermStart[iPolicy + 1] - m_aiPrereqWeightTermStart[iPolicy];
+	return iNumTerms > 0 ? &m_aPrereqWeightTerms[m_aiPrereqWeightTermStart[iPolicy]] : NULL;
+}
+
+/// Enumerates every path the old recursive propagation would take from each policy and collapses them into (prereq, depth) counts
+void CvPolicyXMLEntries::BuildPrereqWeightTerms(int iPropagationLevels)
+{
+	const int iNumPolicies = GetNumPolicies();
+	m_aPrereqWeightTerms.clear();
+	m_aiPrereqWeightTermStart.assign(iNumPolicies + 1, 0);
+	m_iPrereqWeightTermLevels = iPropagationLevels;
+
+	std::map<std::pair<int, int>, int> mPathCounts;
+	for(int iPolicy = 0; iPolicy < iNumPolicies; iPolicy++)
+	{
+		m_aiPrereqWeightTermStart[iPolicy] = m_aPrereqWeightTerms.size();
+
+		mPathCounts.clear();
+		AddPrereqWeightPaths(iPolicy, 0, 0, iPropagationLevels, mPathCounts);
+		// Map is keyed on (depth, prereq), so terms come out sorted by depth
+		for(std::map<std::pair<int, int>, int>::const_iterator it = mPathCounts.begin(); it != mPathCounts.end(); ++it)
+		{
+			PrereqWeightTerm kTerm;
+			kTerm.m_iDepth = it->first.first;
+			kTerm.m_iPrereq = it->first.second;
+			kTerm.m_iCount = it->second;
+			m_aPrereqWeightTerms.push_back(kTerm);
+		}
+	}
+	m_aiPrereqWeightTermStart[iNumPolicies] = m_aPrereqWeightTerms.size();
+}
+
+/// Mirrors CvPolicyAI::PropagateWeights(), including the way each successive prereq of a policy is visited one propagation level deeper than the previous one
+void CvPolicyXMLEntries::AddPrereqWeightPaths(int iPolicy, int iDepth, int iPropagationLevel, int iPropagationLevels, std::map<std::pair<int, int>, int>& mPathCounts)
+{
+	CvPolicyEntry* pkPolicyInfo = GetPolicyEntry(iPolicy);
+	if(pkPolicyInfo && iPropagationLevel < iPropagationLevels)
+	{
+		CvAssertMsg(iDepth <= GetNumPolicies(), "Policy prerequisites contain a cycle");
+		if(iDepth > GetNumPolicies())
+			return;
+
+		for(int iI = 0; iI < GC.getNUM_OR_TECH_PREREQS(); iI++)
+		{
+			int iPrereq = pkPolicyInfo->GetPrereqAndPolicies(iI);
+			if(iPrereq != NO_POLICY)
+			{
+				mPathCounts[std::make_pair(iDepth + 1, iPrereq)]++;
+				AddPrereqWeightPaths(iPrereq, iDepth + 1, iPropagationLevel + iI, iPropagationLevels, mPathCounts);
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+}
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+
 /// Returns vector of PolicyBranch entries
 std::vector<CvPolicyBranchEntry*>& CvPolicyXMLEntries::GetPolicyBranchEntries()
 {
@@ -2247,6 +2323,12 @@ void CvPlayerPolicies::SetPolicy(PolicyTypes eIndex, bool bNewValue)
 	if(HasPolicy(eIndex) != bNewValue)
 	{
 		m_pabHasPolicy[eIndex] = bNewValue;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+		CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+		CvUnit::DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 
 		int iChange = bNewValue ? 1 : -1;
 		GetPlayer()->ChangeNumPolicies(iChange);
@@ -3130,6 +3212,9 @@ void CvPlayerPolicies::SetPolicyBranchUnlocked(PolicyBranchTypes eBranchType, bo
 
 	if(IsPolicyBranchUnlocked(eBranchType) != bNewValue)
 	{
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+		CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 		// Unlocked?
 		if (bNewValue)
 		{
@@ -483,7 +483,26 @@ public:
 
 	void DeletePolicyBranchesArray();
 
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+	// One term of a policy's flattened prerequisite propagation: iCount distinct paths reach iPrereq after iDepth propagation steps
+	struct PrereqWeightTerm
+	{
+		int m_iPrereq;
+		int m_iDepth;
+		int m_iCount;
+	};
+	const PrereqWeightTerm* GetPrereqWeightTerms(int iPolicy, int iPropagationLevels, int& iNumTerms);
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+
 private:
+#ifdef AUI_POLICY_PREREQ_WEIGHT_CLOSURE
+	void BuildPrereqWeightTerms(int iPropagationLevels);
+	void AddPrereqWeightPaths(int iPolicy, int iDepth, int iPropagationLevel, int iPropagationLevels, std::map<std::pair<int, int>, int>& mPathCounts);
+
+	std::vector<PrereqWeightTerm> m_aPrereqWeightTerms;
+	std::vector<int> m_aiPrereqWeightTermStart;
+	int m_iPrereqWeightTermLevels;
+#endif // AUI_POLICY_PREREQ_WEIGHT_CLOSURE
 	std::vector<CvPolicyEntry*> m_paPolicyEntries;
 	std::vector<CvPolicyBranchEntry*> m_paPolicyBranchEntries;
 };
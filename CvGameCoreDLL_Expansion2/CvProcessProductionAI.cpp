@@ -96,6 +96,28 @@ void CvProcessProductionAI::AddFlavorWeights(FlavorTypes eFlavor, int iWeight)
 	}
 }
 
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+/// Establish weights for all flavors at once (one weight per flavor, indexed by flavor type)
+void CvProcessProductionAI::AddFlavorWeights(const int* paiFlavorWeights)
+{
+	const int iNumFlavors = GC.getNumFlavorTypes();
+
+	for(int iProcess = 0; iProcess < GC.getNumProcessInfos(); iProcess++)
+	{
+		CvProcessInfo* entry = GC.getProcessInfo((ProcessTypes)iProcess);
+		if(entry)
+		{
+			int iWeight = 0;
+			for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+			{
+				iWeight += entry->GetFlavorValue(iFlavor) * paiFlavorWeights[iFlavor];
+			}
+			m_ProcessAIWeights.IncreaseWeight(iProcess, iWeight);
+		}
+	}
+}
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+
 /// Retrieve sum of weights on one item
 int CvProcessProductionAI::GetWeight(ProcessTypes eProject)
 {
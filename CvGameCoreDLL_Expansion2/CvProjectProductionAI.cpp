@@ -86,6 +86,28 @@ void CvProjectProductionAI::AddFlavorWeights(FlavorTypes eFlavor, int iWeight)
 	}
 }
 
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+/// Establish weights for all flavors at once (one weight per flavor, indexed by flavor type)
+void CvProjectProductionAI::AddFlavorWeights(const int* paiFlavorWeights)
+{
+	const int iNumFlavors = GC.getNumFlavorTypes();
+
+	for(int iProject = 0; iProject < GC.GetGameProjects()->GetNumProjects(); iProject++)
+	{
+		CvProjectEntry* entry = GC.GetGameProjects()->GetEntry(iProject);
+		if(entry)
+		{
+			int iWeight = 0;
+			for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+			{
+				iWeight += entry->GetFlavorValue(iFlavor) * paiFlavorWeights[iFlavor];
+			}
+			m_ProjectAIWeights.IncreaseWeight(iProject, iWeight);
+		}
+	}
+}
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+
 /// Retrieve sum of weights on one item
 int CvProjectProductionAI::GetWeight(ProjectTypes eProject)
 {
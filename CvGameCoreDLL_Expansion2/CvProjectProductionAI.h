@@ -40,6 +40,9 @@ public:
 
 	// Establish/retrieve weights for one flavor
 	void AddFlavorWeights(FlavorTypes eFlavor, int iWeight);
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+	void AddFlavorWeights(const int* paiFlavorWeights);
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
 	int GetWeight(ProjectTypes eProject);
 
 	// Recommend highest-weighted Project
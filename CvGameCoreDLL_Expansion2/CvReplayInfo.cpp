@@ -175,6 +175,17 @@ void CvReplayInfo::createInfo()
 					uiDataSet = m_dataSetMap.size() - 1;
 				}
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+				// Fill the replay's dataset in place straight from the player's history
+				const CvPlayer::TurnData& playerData = player.getReplayDataHistory(uiPlayerDataSet);
+				TurnData& turnData = dataSet[uiDataSet];
+				turnData.clear();
+
+				for(CvPlayer::TurnData::const_iterator it = playerData.begin(); it != playerData.end(); ++it)
+				{
+					turnData[(*it).first - m_iInitialTurn] = (*it).second;
+				}
+#else
 				CvPlayer::TurnData playerData = player.getReplayDataHistory(uiPlayerDataSet);
 				TurnData turnData;
 
@@ -184,6 +195,7 @@ void CvReplayInfo::createInfo()
 				}
 
 				dataSet[uiDataSet] = turnData;
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 			}
 
 			m_listPlayerDataSets.push_back(dataSet);
@@ -354,6 +354,79 @@ void CvCitySiteEvaluator::ComputeFlavorMultipliers(CvPlayer* pPlayer)
 	m_iFlavorMultiplier[SITE_EVALUATION_STRATEGIC] = 10;
 }
 
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+/// Checksum of the player-level (ie. not plot-local) inputs of PlotFoundValue(), including resource, religion and yield change state; call after ComputeFlavorMultipliers() (unsigned so the mixing may wrap around)
+uint CvCitySiteEvaluator::GetPlayerInputsChecksum(CvPlayer* pPlayer) const
+{
+	uint uiChecksum = 0;
+	for(int iI = 0; iI < NUM_SITE_EVALUATION_FACTORS; iI++)
+	{
+		uiChecksum = uiChecksum * 31 + m_iFlavorMultiplier[iI];
+	}
+	CvGrandStrategyAI* pGrandStrategyAI = pPlayer->GetGrandStrategyAI();
+	uiChecksum = uiChecksum * 31 + pGrandStrategyAI->GetPersonalityAndGrandStrategy((FlavorTypes)m_iNavalIndex);
+	uiChecksum = uiChecksum * 31 + pGrandStrategyAI->GetPersonalityAndGrandStrategy((FlavorTypes)m_iGrowthIndex);
+	uiChecksum = uiChecksum * 31 + pGrandStrategyAI->GetPersonalityAndGrandStrategy((FlavorTypes)m_iExpansionIndex);
+	uiChecksum = uiChecksum * 31 + pPlayer->GetDiplomacyAI()->GetBoldness();
+	uiChecksum = uiChecksum * 31 + (pPlayer->getCapitalCity() ? pPlayer->getCapitalCity()->getArea() : -1);
+	// Own cities change area city counts, unique luxury eligibility and the first coastal city bonus
+	uiChecksum = uiChecksum * 31 + pPlayer->getNumCities();
+	// Techs change resource visibility and plot yields, policies change plot yields
+	uiChecksum = uiChecksum * 31 + GET_TEAM(pPlayer->getTeam()).GetTeamTechs()->GetNumTechsKnown();
+	uiChecksum = uiChecksum * 31 + pPlayer->GetPlayerPolicies()->GetNumPoliciesOwned();
+	uiChecksum = uiChecksum * 31 + (pPlayer->isHuman() ? 1 : 0);
+
+	int iI;
+	// Player-wide yield changes and thresholds used by the Compute...Value() functions
+	for(iI = 0; iI < NUM_YIELD_TYPES; iI++)
+	{
+		const YieldTypes eYield = (YieldTypes)iI;
+		uiChecksum = uiChecksum * 31 + pPlayer->GetCityYieldChange(eYield);
+		uiChecksum = uiChecksum * 31 + pPlayer->GetCoastalCityYieldChange(eYield);
+		uiChecksum = uiChecksum * 31 + pPlayer->getExtraYieldThreshold(eYield);
+	}
+
+	// Resource state: only whether we have a resource matters for happiness and tradeable resource values
+	uiChecksum = uiChecksum * 31 + pPlayer->GetExtraHappinessPerLuxury();
+	uiChecksum = uiChecksum * 31 + (pPlayer->GetHappinessFromResources() > 0 ? 1 : 0);
+	for(iI = 0; iI < GC.getNumResourceInfos(); iI++)
+	{
+		const ResourceTypes eResource = (ResourceTypes)iI;
+		int iResourceState = (pPlayer->getNumResourceTotal(eResource, false) == 0 ? 1 : 0);
+		iResourceState += (pPlayer->getNumResourceTotal(eResource) == 0 ? 2 : 0);
+		uiChecksum = uiChecksum * 31 + iResourceState;
+	}
+
+	// Nature yields use the religion of the working city (our capital for unowned plots) and league feature yield changes
+	const CvCity* pLoopCity;
+	int iLoop;
+	for(pLoopCity = pPlayer->firstCity(&iLoop); pLoopCity != NULL; pLoopCity = pPlayer->nextCity(&iLoop))
+	{
+		CvCityReligions* pCityReligions = pLoopCity->GetCityReligions();
+		const ReligionTypes eMajority = pCityReligions->GetReligiousMajority();
+		uiChecksum = uiChecksum * 31 + pLoopCity->GetID();
+		uiChecksum = uiChecksum * 31 + (int)eMajority;
+		uiChecksum = uiChecksum * 31 + (int)pCityReligions->GetSecondaryReligionPantheonBelief();
+		if(eMajority != NO_RELIGION)
+		{
+			const CvReligion* pReligion = GC.getGame().GetGameReligions()->GetReligion(eMajority, pPlayer->GetID());
+			uiChecksum = uiChecksum * 31 + (pReligion ? pReligion->m_Beliefs.GetNumBeliefs() : -1);
+		}
+	}
+	uiChecksum = uiChecksum * 31 + (pPlayer->getCapitalCity() ? pPlayer->getCapitalCity()->GetID() : -1);
+	CvGameLeagues* pGameLeagues = GC.getGame().GetGameLeagues();
+	for(iI = 0; iI < GC.getNumFeatureInfos(); iI++)
+	{
+		for(int iJ = 0; iJ < NUM_YIELD_TYPES; iJ++)
+		{
+			uiChecksum = uiChecksum * 31 + pGameLeagues->GetFeatureYieldChange(pPlayer->GetID(), (FeatureTypes)iI, (YieldTypes)iJ);
+		}
+	}
+
+	return uiChecksum;
+}
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+
 /// Retrieve the relative value of this plot (including plots that would be in city radius)
 int CvCitySiteEvaluator::PlotFoundValue(CvPlot* pPlot, CvPlayer* pPlayer, YieldTypes eYield, bool)
 {
@@ -40,6 +40,9 @@ public:
 	virtual int PlotFoundValue(CvPlot* pPlot, CvPlayer* pPlayer, YieldTypes eYield = NO_YIELD, bool bCoastOnly=true);
 	virtual int PlotFertilityValue(CvPlot* pPlot);
 	virtual int BestFoundValueForSpecificYield(CvPlayer* pPlayer, YieldTypes eYield);
+#ifdef AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
+	uint GetPlayerInputsChecksum(CvPlayer* pPlayer) const;
+#endif // AUI_PLAYERAI_INCREMENTAL_FOUND_VALUES
 
 protected:
 	// Each of these routines computes a number from 0 (no value) to 100 (best possible value)
@@ -3348,6 +3348,9 @@ void CvTeam::makeHasMet(TeamTypes eIndex, bool bSuppressMessages)
 	if(!isHasMet(eIndex))
 	{
 		m_abHasMet[eIndex] = true;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+		CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 		SetTurnTeamMet(eIndex, GC.getGame().getGameTurn());
 
@@ -3561,6 +3564,12 @@ void CvTeam::setAtWar(TeamTypes eIndex, bool bNewValue)
 	CvAssertMsg(eIndex != GetID() || bNewValue == false, "Team is setting war with itself!");
 	if(eIndex != GetID() || bNewValue == false)
 		m_abAtWar[eIndex] = bNewValue;
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	CvUnit::DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 	gDLL->GameplayWarStateChanged(GetID(), eIndex, bNewValue);
 
@@ -3926,6 +3935,9 @@ void CvTeam::SetAllowsOpenBordersToTeam(TeamTypes eIndex, bool bNewValue)
 	if(IsAllowsOpenBordersToTeam(eIndex) != bNewValue)
 	{
 		m_abOpenBorders[eIndex] = bNewValue;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+		CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 		GC.getMap().verifyUnitValidPlot();
 
@@ -6892,6 +6904,24 @@ void CvTeam::Read(FDataStream& kStream)
 	ArrayWrapper<int> kExtraMovesWrapper(NUM_DOMAIN_TYPES, &m_aiExtraMoves[0]);
 	kStream >> kExtraMovesWrapper;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	bool bTypeDictionary = (uiVersion >= 2);
+	if (bTypeDictionary)
+	{
+		// Type dictionaries used by the team arrays
+		CvInfosSerializationHelper::ReadTypeDictionary<VoteSourceTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<VictoryTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<SmallAwardTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<RouteTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<BuildTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<ProjectTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<TerrainTypes>(kStream);
+		CvInfosSerializationHelper::ReadTypeDictionary<ResourceTypes>(kStream);
+
+		CvInfosSerializationHelper::ReadDenseDataArray<VoteSourceTypes>(kStream, m_aiForceTeamVoteEligibilityCount, GC.getNumVoteSourceInfos());
+	}
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_aiForceTeamVoteEligibilityCount, GC.getNumVoteSourceInfos());
 
 	ArrayWrapper<int> kTurnMadePeaceWrapper(MAX_TEAMS, &m_paiTurnMadePeaceTreatyWithTeam[0]);
@@ -6930,6 +6960,21 @@ void CvTeam::Read(FDataStream& kStream)
 	ArrayWrapper<bool> kForcePeaceWrapper(MAX_TEAMS, &m_abForcePeace[0]);
 	kStream >> kForcePeaceWrapper;
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<VictoryTypes>(kStream, m_abCanLaunch, GC.getNumVictoryInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<VictoryTypes>(kStream, m_abVictoryAchieved, GC.getNumVictoryInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<SmallAwardTypes>(kStream, m_abSmallAwardAchieved, GC.getNumSmallAwardInfos());
+
+		CvInfosSerializationHelper::ReadDenseDataArray<RouteTypes>(kStream, m_paiRouteChange, GC.getNumRouteInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<BuildTypes>(kStream, m_paiBuildTimeChange, GC.getNumBuildInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<ProjectTypes>(kStream, m_paiProjectCount, GC.getNumProjectInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<ProjectTypes>(kStream, m_paiProjectDefaultArtTypes, GC.getNumProjectInfos());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_abCanLaunch, GC.getNumVictoryInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_abVictoryAchieved, GC.getNumVictoryInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_abSmallAwardAchieved, GC.getNumSmallAwardInfos());
@@ -6938,6 +6983,9 @@ void CvTeam::Read(FDataStream& kStream)
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiBuildTimeChange, GC.getNumBuildInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiProjectCount, GC.getNumProjectInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiProjectDefaultArtTypes, GC.getNumProjectInfos());
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	//project art types
 
@@ -6945,7 +6993,11 @@ void CvTeam::Read(FDataStream& kStream)
 	kStream >> iNumProjects;
 	for(int i=0; i<iNumProjects; i++)
 	{
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+		int iType = (bTypeDictionary ? CvInfosSerializationHelper::ReadDenseType<ProjectTypes>(kStream) : CvInfosSerializationHelper::ReadHashed(kStream));
+#else
 		int iType = CvInfosSerializationHelper::ReadHashed(kStream);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 		if (iType != -1)
 		{
 			for(int j=0; j<m_paiProjectCount[iType]; j++)
@@ -6966,6 +7018,11 @@ void CvTeam::Read(FDataStream& kStream)
 		}
 	}
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+		CvInfosSerializationHelper::ReadDenseDataArray<ProjectTypes>(kStream, m_paiProjectMaking, GC.getNumProjectInfos());
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiProjectMaking, GC.getNumProjectInfos());
 
 	UnitClassArrayHelpers::Read(kStream, m_paiUnitClassCount);
@@ -6973,8 +7030,20 @@ void CvTeam::Read(FDataStream& kStream)
 	BuildingClassArrayHelpers::Read(kStream, m_paiBuildingClassCount);
 	BuildingArrayHelpers::Read(kStream, m_paiObsoleteBuildingCount);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+	{
+		CvInfosSerializationHelper::ReadDenseDataArray<TerrainTypes>(kStream, m_paiTerrainTradeCount, GC.getNumTerrainInfos());
+		CvInfosSerializationHelper::ReadDenseDataArray<VictoryTypes>(kStream, m_aiVictoryCountdown, GC.getNumVictoryInfos());
+	}
+	else
+	{
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_paiTerrainTradeCount, GC.getNumTerrainInfos());
 	CvInfosSerializationHelper::ReadHashedDataArray(kStream, m_aiVictoryCountdown, GC.getNumVictoryInfos());
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	}
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	ArrayWrapper<int> kTurnTeamMetWrapper(MAX_CIV_TEAMS, &m_aiTurnTeamMet[0]);
 	kStream >> kTurnTeamMetWrapper;
@@ -6985,6 +7054,11 @@ void CvTeam::Read(FDataStream& kStream)
 	ImprovementArrayHelpers::ReadYieldArray(kStream, m_ppaaiImprovementNoFreshWaterYieldChange, NUM_YIELD_TYPES);
 	ImprovementArrayHelpers::ReadYieldArray(kStream, m_ppaaiImprovementFreshWaterYieldChange, NUM_YIELD_TYPES);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	if (bTypeDictionary)
+		CvInfosSerializationHelper::ReadDenseTypeArray(kStream, m_aeRevealedResources);
+	else
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	CvInfosSerializationHelper::ReadHashedTypeArray(kStream, m_aeRevealedResources);
 
 	// Fix bad 'at war' flags where we are at war with ourselves.  Not a good thing.
@@ -7000,7 +7074,11 @@ void CvTeam::Read(FDataStream& kStream)
 void CvTeam::Write(FDataStream& kStream) const
 {
 	// Current version number
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	uint uiVersion = 2;
+#else
 	uint uiVersion = 1;
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	kStream << uiVersion;
 
 	kStream << m_iNumMembers;
@@ -7054,7 +7132,20 @@ void CvTeam::Write(FDataStream& kStream) const
 	kStream << ArrayWrapperConst<int>(MAX_TEAMS, &m_aiNumTurnsLockedIntoWar[0]);
 	kStream << ArrayWrapperConst<int>(NUM_DOMAIN_TYPES, &m_aiExtraMoves[0]);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteTypeDictionary<VoteSourceTypes>(kStream, GC.getNumVoteSourceInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<VictoryTypes>(kStream, GC.getNumVictoryInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<SmallAwardTypes>(kStream, GC.getNumSmallAwardInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<RouteTypes>(kStream, GC.getNumRouteInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<BuildTypes>(kStream, GC.getNumBuildInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<ProjectTypes>(kStream, GC.getNumProjectInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<TerrainTypes>(kStream, GC.getNumTerrainInfos());
+	CvInfosSerializationHelper::WriteTypeDictionary<ResourceTypes>(kStream, GC.getNumResourceInfos());
+
+	CvInfosSerializationHelper::WriteDenseDataArray(kStream, m_aiForceTeamVoteEligibilityCount, GC.getNumVoteSourceInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<VoteSourceTypes, int>(kStream, m_aiForceTeamVoteEligibilityCount, GC.getNumVoteSourceInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	kStream << ArrayWrapperConst<int>(MAX_TEAMS, &m_paiTurnMadePeaceTreatyWithTeam[0]);
 	kStream << ArrayWrapperConst<int>(MAX_TEAMS, &m_aiIgnoreWarningCount[0]);
@@ -7070,6 +7161,15 @@ void CvTeam::Write(FDataStream& kStream) const
 	kStream << ArrayWrapperConst<bool>(MAX_TEAMS, &m_abTradeAgreement[0]);
 	kStream << ArrayWrapperConst<bool>(MAX_TEAMS, &m_abForcePeace[0]);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<bool>(kStream, m_abCanLaunch, GC.getNumVictoryInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<bool>(kStream, m_abVictoryAchieved, GC.getNumVictoryInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<bool>(kStream, m_abSmallAwardAchieved, GC.getNumSmallAwardInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiRouteChange, GC.getNumRouteInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiBuildTimeChange, GC.getNumBuildInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiProjectCount, GC.getNumProjectInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiProjectDefaultArtTypes, GC.getNumProjectInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<VictoryTypes, bool>(kStream, m_abCanLaunch, GC.getNumVictoryInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<VictoryTypes, bool>(kStream, m_abVictoryAchieved, GC.getNumVictoryInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<SmallAwardTypes, bool>(kStream, m_abSmallAwardAchieved, GC.getNumSmallAwardInfos());
@@ -7077,27 +7177,41 @@ void CvTeam::Write(FDataStream& kStream) const
 	CvInfosSerializationHelper::WriteHashedDataArray<BuildTypes, int>(kStream, m_paiBuildTimeChange, GC.getNumBuildInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<ProjectTypes, int>(kStream, m_paiProjectCount, GC.getNumProjectInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<ProjectTypes, int>(kStream, m_paiProjectDefaultArtTypes, GC.getNumProjectInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	//project art types
 	kStream << GC.getNumProjectInfos();
 
 	for(int i=0; i<GC.getNumProjectInfos(); i++)
 	{
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+		CvInfosSerializationHelper::WriteDenseType(kStream, i);
+#else
 		CvInfosSerializationHelper::WriteHashed(kStream, GC.getProjectInfo((ProjectTypes)i));
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 		for(int j=0; j<m_paiProjectCount[i]; j++)
 		{
 			kStream << m_pavProjectArtTypes[i][j];
 		}
 	}
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiProjectMaking, GC.getNumProjectInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<ProjectTypes, int>(kStream, m_paiProjectMaking, GC.getNumProjectInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 
 	UnitClassArrayHelpers::Write(kStream, m_paiUnitClassCount, GC.getNumUnitClassInfos());
 	BuildingClassArrayHelpers::Write(kStream, m_paiBuildingClassCount, GC.getNumBuildingClassInfos());
 	BuildingArrayHelpers::Write(kStream, m_paiObsoleteBuildingCount, GC.getNumBuildingInfos());
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_paiTerrainTradeCount, GC.getNumTerrainInfos());
+	CvInfosSerializationHelper::WriteDenseDataArray<int>(kStream, m_aiVictoryCountdown, GC.getNumVictoryInfos());
+#else
 	CvInfosSerializationHelper::WriteHashedDataArray<TerrainTypes, int>(kStream, m_paiTerrainTradeCount, GC.getNumTerrainInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<VictoryTypes, int>(kStream, m_aiVictoryCountdown, GC.getNumVictoryInfos());
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 	kStream << ArrayWrapperConst<int>(MAX_CIV_TEAMS, &m_aiTurnTeamMet[0]);
 
 	m_pTeamTechs->Write(kStream);
@@ -7107,7 +7221,11 @@ void CvTeam::Write(FDataStream& kStream) const
 	ImprovementArrayHelpers::WriteYieldArray(kStream, m_ppaaiImprovementNoFreshWaterYieldChange, iNumImprovements);
 	ImprovementArrayHelpers::WriteYieldArray(kStream, m_ppaaiImprovementFreshWaterYieldChange, iNumImprovements);
 
+#ifdef AUI_SERIALIZATION_TYPE_DICTIONARY
+	CvInfosSerializationHelper::WriteDenseTypeArray(kStream, m_aeRevealedResources);
+#else
 	CvInfosSerializationHelper::WriteHashedTypeArray(kStream, m_aeRevealedResources);
+#endif // AUI_SERIALIZATION_TYPE_DICTIONARY
 }
 
 // CACHE: cache frequently used values
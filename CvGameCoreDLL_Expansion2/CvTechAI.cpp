@@ -349,6 +349,41 @@ bool CvTechAI::HaveAllInternetTechs()
 void CvTechAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 {
 	int iTechLoop;
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+	CvTechXMLEntries* pkTechEntries = m_pCurrentTechs->GetTechs();
+	const int iPropagationLevels = GC.getTECH_WEIGHT_PROPAGATION_LEVELS();
+
+	// Loop through techs looking for ones that are just getting some new weight
+	for(iTechLoop = 0; iTechLoop < pkTechEntries->GetNumTechs(); iTechLoop++)
+	{
+		int iWeight = paiTempWeights[iTechLoop];
+		if(iWeight > 0 && pkTechEntries->GetEntry(iTechLoop))
+		{
+			int iNumTerms = 0;
+			const CvTechXMLEntries::PrereqWeightTerm* pTerms = pkTechEntries->GetPrereqWeightTerms(iTechLoop, iPropagationLevels, iNumTerms);
+			int iDepth = 0;
+			bool bExhausted = false;
+			for(int iI = 0; iI < iNumTerms && !bExhausted; iI++)
+			{
+				// Reduce the weight one step at a time so the integer rounding matches the recursion; it stops going deeper once nothing is left
+				while(iDepth < pTerms[iI].m_iDepth)
+				{
+					if(iWeight <= 0)
+					{
+						bExhausted = true;
+						break;
+					}
+					iWeight = iWeight * iPropagationPercent / 100;
+					iDepth++;
+				}
+				if(!bExhausted)
+				{
+					m_TechAIWeights.IncreaseWeight(pTerms[iI].m_iPrereq, iWeight * pTerms[iI].m_iCount);
+				}
+			}
+		}
+	}
+#else
 
 	// Loop through techs looking for ones that are just getting some new weight
 	for(iTechLoop = 0; iTechLoop < m_pCurrentTechs->GetTechs()->GetNumTechs(); iTechLoop++)
@@ -359,6 +394,7 @@ void CvTechAI::WeightPrereqs(int* paiTempWeights, int iPropagationPercent)
 			PropagateWeights(iTechLoop, paiTempWeights[iTechLoop], iPropagationPercent, 0);
 		}
 	}
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
 }
 
 /// Recursive routine to weight all prerequisite techs
@@ -539,6 +539,9 @@ int CvTechEntry::GetPrereqAndTechs(int i) const
 //=====================================
 /// Constructor
 CvTechXMLEntries::CvTechXMLEntries(void)
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+	: m_iPrereqWeightTermLevels(-1)
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
 {
 
 }
@@ -570,6 +573,11 @@ void CvTechXMLEntries::DeleteArray()
 	}
 
 	m_paTechEntries.clear();
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+	m_aPrereqWeightTerms.clear();
+	m_aiPrereqWeightTermStart.clear();
+	m_iPrereqWeightTermLevels = -1;
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
 }
 
 /// Get a specific entry
@@ -578,6 +586,74 @@ CvTechEntry* CvTechXMLEntries::GetEntry(int index)
 	return m_paTechEntries[index];
 }
 
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+/// Flattened prerequisite propagation terms for a tech, sorted by depth (built on first use)
+const CvTechXMLEntries::PrereqWeightTerm* CvTechXMLEntries::GetPrereqWeightTerms(int iTech, int iPropagationLevels, int& iNumTerms)
+{
+	if(m_iPrereqWeightTermLevels != iPropagationLevels || (int)m_aiPrereqWeightTermStart.size() != GetNumTechs() + 1)
+	{
+		BuildPrereqWeightTerms(iPropagationLevels);
+	}
+
+	iNumTerms = m_aiPrereqWeightTermStart[iTech + 1] - m_aiPrereqWeightTermStart[iTech];
+	return iNumTerms > 0 ? &m_aPrereqWeightTerms[m_aiPrereqWeightTermStart[iTech]] : NULL;
+}
+
+/// Enumerates every path the old recursive propagation would take from each tech and collapses them into (prereq, depth) counts
+void CvTechXMLEntries::BuildPrereqWeightTerms(int iPropagationLevels)
+{
+	const int iNumTechs = GetNumTechs();
+	m_aPrereqWeightTerms.clear();
+	m_aiPrereqWeightTermStart.assign(iNumTechs + 1, 0);
+	m_iPrereqWeightTermLevels = iPropagationLevels;
+
+	std::map<std::pair<int, int>, int> mPathCounts;
+	for(int iTech = 0; iTech < iNumTechs; iTech++)
+	{
+		m_aiPrereqWeightTermStart[iTech] = m_aPrereqWeightTerms.size();
+
+		mPathCounts.clear();
+		AddPrereqWeightPaths(iTech, 0, 0, iPropagationLevels, mPathCounts);
+		// Map is keyed on (depth, prereq), so terms come out sorted by depth
+		for(std::map<std::pair<int, int>, int>::const_iterator it = mPathCounts.begin(); it != mPathCounts.end(); ++it)
+		{
+			PrereqWeightTerm kTerm;
+			kTerm.m_iDepth = it->first.first;
+			kTerm.m_iPrereq = it->first.second;
+			kTerm.m_iCount = it->second;
+			m_aPrereqWeightTerms.push_back(kTerm);
+		}
+	}
+	m_aiPrereqWeightTermStart[iNumTechs] = m_aPrereqWeightTerms.size();
+}
+
+/// Mirrors CvTechAI::PropagateWeights(), including the way each successive prereq of a tech is visited one propagation level deeper than the previous one
+void CvTechXMLEntries::AddPrereqWeightPaths(int iTech, int iDepth, int iPropagationLevel, int iPropagationLevels, std::map<std::pair<int, int>, int>& mPathCounts)
+{
+	CvTechEntry* pkTechInfo = GetEntry(iTech);
+	if(pkTechInfo && iPropagationLevel < iPropagationLevels)
+	{
+		CvAssertMsg(iDepth <= GetNumTechs(), "Tech prerequisites contain a cycle");
+		if(iDepth > GetNumTechs())
+			return;
+
+		for(int iI = 0; iI < GC.getNUM_OR_TECH_PREREQS(); iI++)
+		{
+			int iPrereq = pkTechInfo->GetPrereqAndTechs(iI);
+			if(iPrereq != NO_TECH)
+			{
+				mPathCounts[std::make_pair(iDepth + 1, iPrereq)]++;
+				AddPrereqWeightPaths(iPrereq, iDepth + 1, iPropagationLevel + iI, iPropagationLevels, mPathCounts);
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+}
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+
 
 //=====================================
 // CvPlayerTechs
@@ -1130,6 +1206,17 @@ bool CvPlayerTechs::CanResearch(TechTypes eTech, bool bTrade) const
 		return false;
 	}
 
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	if(!bTrade)
+	{
+		if(!GET_TEAM(m_pPlayer->getTeam()).GetTeamTechs()->ArePrereqsMet(eTech))
+		{
+			return false;
+		}
+	}
+	else
+	{
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 	bFoundPossible = false;
 	bFoundValid = false;
 
@@ -1174,6 +1261,9 @@ bool CvPlayerTechs::CanResearch(TechTypes eTech, bool bTrade) const
 			}
 		}
 	}
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	}
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 	// Is it disabled for some reason?
 	if(!CanEverResearch(eTech))
@@ -1618,6 +1708,9 @@ CvTeamTechs::CvTeamTechs():
 	m_pabNoTradeTech(NULL),
 	m_paiResearchProgress(NULL),
 	m_paiTechCount(NULL)
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	, m_pabPrereqsMet(NULL)
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 {
 }
 
@@ -1642,6 +1735,10 @@ void CvTeamTechs::Init(CvTechXMLEntries* pTechs, CvTeam* pTeam)
 	m_paiResearchProgress = FNEW(int [m_pTechs->GetNumTechs()], c_eCiv5GameplayDLL, 0);
 	CvAssertMsg(m_paiTechCount==NULL, "about to leak memory, CvTeamTechs::m_paiTechCount");
 	m_paiTechCount = FNEW(int [m_pTechs->GetNumTechs()], c_eCiv5GameplayDLL, 0);
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	CvAssertMsg(m_pabPrereqsMet==NULL, "about to leak memory, CvTeamTechs::m_pabPrereqsMet");
+	m_pabPrereqsMet = FNEW(bool[m_pTechs->GetNumTechs()], c_eCiv5GameplayDLL, 0);
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 	Reset();
 }
@@ -1653,6 +1750,9 @@ void CvTeamTechs::Uninit()
 	SAFE_DELETE_ARRAY(m_pabNoTradeTech);
 	SAFE_DELETE_ARRAY(m_paiResearchProgress);
 	SAFE_DELETE_ARRAY(m_paiTechCount);
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	SAFE_DELETE_ARRAY(m_pabPrereqsMet);
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 }
 
 /// Reset tech status arrays
@@ -1669,6 +1769,10 @@ void CvTeamTechs::Reset()
 		m_paiResearchProgress[iI] = 0;
 		m_paiTechCount[iI] = 0;
 	}
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+
+	UpdatePrereqsMet();
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 }
 
 // WARNING: Expansion only and only so some pre-release saves can be loaded
@@ -1787,6 +1891,10 @@ void CvTeamTechs::Read(FDataStream& kStream)
 
 		_freea(paTechIDs);
 	}
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+
+	UpdatePrereqsMet();
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 }
 
 //	---------------------------------------------------------------------------
@@ -1828,6 +1936,9 @@ void CvTeamTechs::SetHasTech(TechTypes eIndex, bool bNewValue)
 	if(m_pabHasTech[eIndex] != bNewValue)
 	{
 		m_pabHasTech[eIndex] = bNewValue;
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+		UpdatePrereqsMet();
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 		if(bNewValue)
 			SetLastTechAcquired(eIndex);
@@ -1865,6 +1976,65 @@ bool CvTeamTechs::HasTech(TechTypes eIndex) const
 		return false;
 }
 
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+/// Accessor: does team have at least one of the tech's OR prereqs and all of its AND prereqs?
+bool CvTeamTechs::ArePrereqsMet(TechTypes eIndex) const
+{
+	CvAssertMsg(eIndex >= 0, "eIndex is expected to be non-negative (invalid Index)");
+	CvAssertMsg(eIndex < GC.getNumTechInfos(), "eIndex is expected to be within maximum bounds (invalid Index)");
+	if(m_pabPrereqsMet != NULL)
+		return m_pabPrereqsMet[eIndex];
+	else
+		return false;
+}
+
+/// Rebuild which techs have their prereqs met, prereq lists are short so a full pass is cheap next to how often CanResearch() is called
+void CvTeamTechs::UpdatePrereqsMet()
+{
+	if(m_pabPrereqsMet == NULL || m_pabHasTech == NULL)
+		return;
+
+	int iNumOrPrereqs = GC.getNUM_OR_TECH_PREREQS();
+	int iNumAndPrereqs = GC.getNUM_AND_TECH_PREREQS();
+	int iI;
+
+	for(int iTech = 0; iTech < m_pTechs->GetNumTechs(); iTech++)
+	{
+		bool bMet = false;
+		CvTechEntry* pkTechEntry = m_pTechs->GetEntry(iTech);
+		if(pkTechEntry != NULL)
+		{
+			bool bFoundPossible = false;
+			bool bFoundValid = false;
+			for(iI = 0; iI < iNumOrPrereqs; iI++)
+			{
+				TechTypes ePrereq = (TechTypes)pkTechEntry->GetPrereqOrTechs(iI);
+				if(ePrereq != NO_TECH)
+				{
+					bFoundPossible = true;
+					if(m_pabHasTech[ePrereq])
+					{
+						bFoundValid = true;
+						break;
+					}
+				}
+			}
+
+			bMet = !bFoundPossible || bFoundValid;
+			for(iI = 0; bMet && iI < iNumAndPrereqs; iI++)
+			{
+				TechTypes ePrereq = (TechTypes)pkTechEntry->GetPrereqAndTechs(iI);
+				if(ePrereq != NO_TECH && !m_pabHasTech[ePrereq])
+				{
+					bMet = false;
+				}
+			}
+		}
+		m_pabPrereqsMet[iTech] = bMet;
+	}
+}
+
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 /// What was the most recent tech acquired?
 TechTypes CvTeamTechs::GetLastTechAcquired() const
 {
@@ -182,7 +182,26 @@ public:
 
 	void DeleteArray();
 
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+	// One term of a tech's flattened prerequisite propagation: iCount distinct paths reach iPrereq after iDepth propagation steps
+	struct PrereqWeightTerm
+	{
+		int m_iPrereq;
+		int m_iDepth;
+		int m_iCount;
+	};
+	const PrereqWeightTerm* GetPrereqWeightTerms(int iTech, int iPropagationLevels, int& iNumTerms);
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+
 private:
+#ifdef AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
+	void BuildPrereqWeightTerms(int iPropagationLevels);
+	void AddPrereqWeightPaths(int iTech, int iDepth, int iPropagationLevel, int iPropagationLevels, std::map<std::pair<int, int>, int>& mPathCounts);
+
+	std::vector<PrereqWeightTerm> m_aPrereqWeightTerms;
+	std::vector<int> m_aiPrereqWeightTermStart;
+	int m_iPrereqWeightTermLevels;
+#endif // AUI_TECHAI_PREREQ_WEIGHT_CLOSURE
 	std::vector<CvTechEntry*> m_paTechEntries;
 };
 
@@ -302,9 +321,15 @@ public:
 	int GetResearchCost(TechTypes eTech) const;
 	int GetResearchLeft(TechTypes eTech) const;
 	CvTechXMLEntries* GetTechs() const;
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	bool ArePrereqsMet(TechTypes eIndex) const;
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 private:
 	int GetMaxResearchOverflow(TechTypes eTech, PlayerTypes ePlayer) const;
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	void UpdatePrereqsMet();
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 
 	TechTypes m_eLastTechAcquired;
 
@@ -312,6 +337,9 @@ private:
 	bool* m_pabNoTradeTech;
 	int* m_paiResearchProgress;  // Stored in hundredths
 	int* m_paiTechCount;
+#ifdef AUI_TEAMTECHS_PREREQS_MET_CACHE
+	bool* m_pabPrereqsMet; // not serialized, rebuilt from m_pabHasTech
+#endif // AUI_TEAMTECHS_PREREQS_MET_CACHE
 	CvTechXMLEntries* m_pTechs;
 	CvTeam* m_pTeam;
 };
@@ -281,6 +281,9 @@ bool CvGameTrade::CreateTradeRoute(CvCity* pOriginCity, CvCity* pDestCity, Domai
 	{
 		return false;
 	}
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 	PlayerTypes eOriginPlayer = pOriginCity->getOwner();
 	PlayerTypes eDestPlayer = pDestCity->getOwner();
@@ -833,6 +836,9 @@ bool CvGameTrade::EmptyTradeRoute(int iIndex)
 	TradeConnection& kTradeConnection = m_aTradeConnections[iIndex];
 	PlayerTypes eOriginPlayer = kTradeConnection.m_eOriginOwner;
 	PlayerTypes eDestPlayer = kTradeConnection.m_eDestOwner;
+#ifdef AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
+	CvGameCulture::DirtyTourismModifierMatrix();
+#endif // AUI_GAME_CULTURE_TOURISM_MODIFIER_MATRIX
 
 	// Remove any visualization
 	if (kTradeConnection.m_unitID != -1)
@@ -118,6 +118,10 @@ void ClearUnitDeltas()
 }
 
 bool s_dispatchingNetMessage = false;
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+// Aura caches stamped with a different value are stale; never 0, so freshly reset units always miss
+uint s_uiAuraCombatCacheEpoch = 1;
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 
 OBJECT_VALIDATE_DEFINITION(CvUnit)
 
@@ -693,6 +697,9 @@ void CvUnit::initWithNameOffset(int iID, UnitTypes eUnit, int iNameOffset, UnitA
 	if(bSetupGraphical)
 		setupGraphical();
 
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	UpdateMilitaryMightContribution();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 }
 
 
@@ -902,6 +909,17 @@ void CvUnit::reset(int iID, UnitTypes eUnit, PlayerTypes eOwner, bool bConstruct
 	m_strName = "";
 	m_eGreatWork = NO_GREAT_WORK;
 	m_iTourismBlastStrength = 0;
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	m_kAuraCombatCache = CvUnitAuraCombatCache();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	m_iPowerFieldPlotIndex = -1;
+	m_iPowerFieldPower = 0;
+	m_bPowerFieldGreatGeneral = false;
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	m_iMilitaryMightContribution = 0;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 	m_strNameIAmNotSupposedToBeUsedAnyMoreBecauseThisShouldNotBeCheckedAndWeNeedToPreserveSaveGameCompatibility = "";
 	m_strScriptData ="";
 	m_iScenarioData = 0;
@@ -1423,6 +1441,11 @@ void CvUnit::kill(bool bDelay, PlayerTypes ePlayer /*= NO_PLAYER*/)
 		}
 	}
 
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	GET_PLAYER(getOwner()).ChangeUnitMilitaryMight(-m_iMilitaryMightContribution);
+	m_iMilitaryMightContribution = 0;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+
 	//////////////////////////////////////////////////////////////////////////
 	// WARNING: This next statement will delete 'this'
 	// ANYTHING BELOW HERE MUST NOT REFERENCE THE UNIT!
@@ -4762,6 +4785,86 @@ int CvUnit::GetPower() const
 	return iPower;
 }
 
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+//	--------------------------------------------------------------------------------
+/// Moves this unit's contribution inside its owner's unit power field to match its current plot, power, and great general status
+void CvUnit::UpdateUnitPowerField(bool bRebuild)
+{
+	VALIDATE_OBJECT
+	if(bRebuild)
+	{
+		// Field was just cleared, so nothing we contributed earlier is still in it
+		m_iPowerFieldPlotIndex = -1;
+		m_iPowerFieldPower = 0;
+		m_bPowerFieldGreatGeneral = false;
+	}
+
+	CvUnitPowerField* pField = GC.getMap().GetUnitPowerFieldIfBuilt(getOwner());
+	if(pField == NULL)
+		return;
+
+	CvPlot* pPlot = plot();
+	int iNewPlotIndex = (pPlot != NULL) ? pPlot->GetPlotIndex() : -1;
+	int iNewPower = (pPlot != NULL && IsCombatUnit()) ? GetPower() : 0;
+	bool bNewGreatGeneral = (pPlot != NULL && IsGreatGeneral());
+	if(iNewPlotIndex == m_iPowerFieldPlotIndex && iNewPower == m_iPowerFieldPower && bNewGreatGeneral == m_bPowerFieldGreatGeneral)
+		return;
+
+	if(m_iPowerFieldPlotIndex != -1)
+	{
+		pField->ChangePlotValues(m_iPowerFieldPlotIndex, -m_iPowerFieldPower, (m_bPowerFieldGreatGeneral ? -1 : 0));
+	}
+	if(iNewPlotIndex != -1)
+	{
+		pField->ChangePlotValues(iNewPlotIndex, iNewPower, (bNewGreatGeneral ? 1 : 0));
+	}
+
+	if(getDomainType() == DOMAIN_AIR)
+	{
+		if(m_iPowerFieldPlotIndex == -1 && iNewPlotIndex != -1)
+		{
+			pField->AddAirUnit(GetID());
+		}
+		else if(m_iPowerFieldPlotIndex != -1 && iNewPlotIndex == -1)
+		{
+			pField->RemoveAirUnit(GetID());
+		}
+	}
+
+	m_iPowerFieldPlotIndex = iNewPlotIndex;
+	m_iPowerFieldPower = iNewPower;
+	m_bPowerFieldGreatGeneral = bNewGreatGeneral;
+}
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+//	--------------------------------------------------------------------------------
+/// Pushes the change in this unit's military might (power, halved for naval units) to its owner's running total
+void CvUnit::UpdateMilitaryMightContribution(bool bRebuild)
+{
+	VALIDATE_OBJECT
+	if(bRebuild)
+	{
+		// Total was just cleared, so nothing we contributed earlier is still in it
+		m_iMilitaryMightContribution = 0;
+	}
+
+	if(m_pUnitInfo == NULL || getOwner() == NO_PLAYER)
+		return;
+
+	int iNewContribution = GetPower();
+	if(getDomainType() == DOMAIN_SEA)
+	{
+		iNewContribution /= 2;
+	}
+	if(iNewContribution != m_iMilitaryMightContribution)
+	{
+		GET_PLAYER(getOwner()).ChangeUnitMilitaryMight(iNewContribution - m_iMilitaryMightContribution);
+		m_iMilitaryMightContribution = iNewContribution;
+	}
+}
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+
 //	--------------------------------------------------------------------------------
 bool CvUnit::canHeal(const CvPlot* pPlot, bool bTestVisible) const
 {
@@ -10334,6 +10437,9 @@ void CvUnit::SetBaseCombatStrength(int iCombat)
 {
 	VALIDATE_OBJECT
 	m_iBaseCombat = iCombat;
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	UpdateUnitPowerField();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 }
 
 //	--------------------------------------------------------------------------------
@@ -10395,6 +10501,31 @@ int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot
 	if(iTempModifier != 0)
 		iModifier += iTempModifier;
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	const CvUnitAuraCombatCache& kAura = GetAuraCombatCache();
+
+	// Great General nearby
+	if(kAura.m_bNearGreatGeneral && !IsIgnoreGreatGeneralBenefit())
+	{
+		iModifier += kPlayer.GetGreatGeneralCombatBonus();
+		iModifier += kPlayer.GetPlayerTraits()->GetGreatGeneralExtraBonus();
+
+		if(kAura.m_bStackedGreatGeneral)
+		{
+			iModifier += GetGreatGeneralCombatModifier();
+		}
+	}
+
+	// Reverse Great General nearby
+	iModifier += kAura.m_iReverseGreatGeneralModifier;
+
+	// Improvement with combat bonus (from trait) nearby
+	iModifier += kAura.m_iNearbyImprovementModifier;
+
+	// Adjacent Friendly military Unit?
+	if(kAura.m_bFriendlyCombatUnitAdjacent)
+		iModifier += GetAdjacentModifier();
+#else
 	// Great General nearby
 	if(IsNearGreatGeneral() && !IsIgnoreGreatGeneralBenefit())
 	{
@@ -10424,6 +10555,7 @@ int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot
 	// Adjacent Friendly military Unit?
 	if(IsFriendlyUnitAdjacent(/*bCombatUnit*/ true))
 		iModifier += GetAdjacentModifier();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 
 	// Our empire fights well in Golden Ages?
 	if(kPlayer.isGoldenAge())
@@ -10612,6 +10744,36 @@ int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot
 	return iModifier;
 }
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+//	--------------------------------------------------------------------------------
+/// Plot scans for modifiers that only depend on what surrounds this unit, redone only if something could have changed them since the last call
+const CvUnitAuraCombatCache& CvUnit::GetAuraCombatCache() const
+{
+	VALIDATE_OBJECT
+	if(m_kAuraCombatCache.m_uiEpoch != s_uiAuraCombatCacheEpoch)
+	{
+		m_kAuraCombatCache.m_bNearGreatGeneral = IsNearGreatGeneral();
+		m_kAuraCombatCache.m_bStackedGreatGeneral = IsStackedGreatGeneral();
+		m_kAuraCombatCache.m_iReverseGreatGeneralModifier = GetReverseGreatGeneralModifier();
+		m_kAuraCombatCache.m_iNearbyImprovementModifier = GetNearbyImprovementModifier();
+		m_kAuraCombatCache.m_bFriendlyCombatUnitAdjacent = (plot() != NULL && IsFriendlyUnitAdjacent(/*bCombatUnit*/ true));
+		m_kAuraCombatCache.m_uiEpoch = s_uiAuraCombatCacheEpoch;
+	}
+	return m_kAuraCombatCache;
+}
+
+//	--------------------------------------------------------------------------------
+/// Invalidates the aura caches of all units
+void CvUnit::DirtyAuraCombatCaches()
+{
+	s_uiAuraCombatCacheEpoch++;
+	if(s_uiAuraCombatCacheEpoch == 0)
+	{
+		s_uiAuraCombatCacheEpoch = 1;
+	}
+}
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+
 //	--------------------------------------------------------------------------------
 /// What is the max strength of this Unit when attacking?
 int CvUnit::GetMaxAttackStrength(const CvPlot* pFromPlot, const CvPlot* pToPlot, const CvUnit* pDefender) const
@@ -11008,6 +11170,27 @@ int CvUnit::GetMaxRangedCombatStrength(const CvUnit* pOtherUnit, const CvCity* p
 	if(iTempModifier != 0)
 		iModifier += iTempModifier;
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	const CvUnitAuraCombatCache& kAura = GetAuraCombatCache();
+
+	// Great General nearby
+	if(kAura.m_bNearGreatGeneral && !IsIgnoreGreatGeneralBenefit())
+	{
+		iModifier += /*25*/ GC.getGREAT_GENERAL_STRENGTH_MOD();
+		iModifier += pTraits->GetGreatGeneralExtraBonus();
+
+		if(kAura.m_bStackedGreatGeneral)
+		{
+			iModifier += GetGreatGeneralCombatModifier();
+		}
+	}
+
+	// Reverse Great General nearby
+	iModifier += kAura.m_iReverseGreatGeneralModifier;
+
+	// Improvement with combat bonus (from trait) nearby
+	iModifier += kAura.m_iNearbyImprovementModifier;
+#else
 	// Great General nearby
 	if(IsNearGreatGeneral() && !IsIgnoreGreatGeneralBenefit())
 	{
@@ -11033,6 +11216,7 @@ int CvUnit::GetMaxRangedCombatStrength(const CvUnit* pOtherUnit, const CvCity* p
 	{
 		iModifier += iNearbyImprovementModifier;
 	}
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 
 	// Our empire fights well in Golden Ages?
 	if(kPlayer.isGoldenAge())
@@ -13268,6 +13452,11 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 	CvAssert((iX == INVALID_PLOT_COORD) || (GC.getMap().plot(iX, iY)->getX() == iX));
 	CvAssert((iY == INVALID_PLOT_COORD) || (GC.getMap().plot(iX, iY)->getY() == iY));
 
+#ifdef AUI_HOMELAND_TURNS_TO_TARGET_MEMO
+	// Paths of other units may now be blocked or freed up
+	GC.getMap().DirtyUnitPositions();
+
+#endif // AUI_HOMELAND_TURNS_TO_TARGET_MEMO
 	eOldActivityType = GetActivityType();
 
 	CvCity *pkPrevGarrisonedCity = GetGarrisonedCity();
@@ -13472,6 +13661,12 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 	}
 
 	CvAssertMsg(plot() == pNewPlot, "plot is expected to equal pNewPlot");
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	UpdateUnitPowerField();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 
 	if(pNewPlot != NULL)
 	{
@@ -14276,6 +14471,12 @@ int CvUnit::setDamage(int iNewValue, PlayerTypes ePlayer, float fAdditionalTextD
 
 	if(iOldValue != getDamage())
 	{
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+		UpdateUnitPowerField();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+		UpdateMilitaryMightContribution();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 		if(IsGarrisoned())
 		{
 			if(GetGarrisonedCity() != NULL)
@@ -14744,6 +14945,12 @@ void CvUnit::setLevel(int iNewValue)
 	{
 		m_iLevel = iNewValue;
 		CvAssert(getLevel() >= 0);
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+		UpdateUnitPowerField();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+		UpdateMilitaryMightContribution();
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 
 		if(getLevel() > GET_PLAYER(getOwner()).getHighestUnitLevel())
 		{
@@ -16246,6 +16453,9 @@ void CvUnit::ChangeGreatGeneralCount(int iChange)
 {
 	VALIDATE_OBJECT
 	m_iGreatGeneralCount += iChange;
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	UpdateUnitPowerField();
+#endif // AUI_MAP_UNIT_POWER_FIELDS
 }
 
 //	--------------------------------------------------------------------------------
@@ -17844,6 +18054,9 @@ void CvUnit::setHasPromotion(PromotionTypes eIndex, bool bNewValue)
 	{
 		CvPromotionEntry& thisPromotion = *GC.getPromotionInfo(eIndex);
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+		DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 		m_Promotions.SetPromotion(eIndex, bNewValue);
 		iChange = ((isHasPromotion(eIndex)) ? 1 : -1);
 
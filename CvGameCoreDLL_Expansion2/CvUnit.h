@@ -74,6 +74,27 @@ struct CvUnitCaptureDefinition
 	}
 };
 
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+// Results of the plot scans behind a unit's surroundings-based combat modifiers
+struct CvUnitAuraCombatCache
+{
+	CvUnitAuraCombatCache()
+		: m_uiEpoch(0)
+		, m_bNearGreatGeneral(false)
+		, m_bStackedGreatGeneral(false)
+		, m_bFriendlyCombatUnitAdjacent(false)
+		, m_iReverseGreatGeneralModifier(0)
+		, m_iNearbyImprovementModifier(0) { }
+
+	uint m_uiEpoch;
+	bool m_bNearGreatGeneral;
+	bool m_bStackedGreatGeneral;
+	bool m_bFriendlyCombatUnitAdjacent;
+	int m_iReverseGreatGeneralModifier;
+	int m_iNearbyImprovementModifier;
+};
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+
 class CvUnit
 {
 
@@ -466,6 +487,10 @@ public:
 	int GetBaseCombatStrengthConsideringDamage() const;
 
 	int GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot* pBattlePlot, bool bIgnoreUnitAdjacency) const;
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	const CvUnitAuraCombatCache& GetAuraCombatCache() const;
+	static void DirtyAuraCombatCaches();
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
 	int GetMaxAttackStrength(const CvPlot* pFromPlot, const CvPlot* pToPlot, const CvUnit* pDefender) const;
 	int GetMaxDefenseStrength(const CvPlot* pInPlot, const CvUnit* pAttacker, bool bFromRangedAttack = false) const;
 	int GetEmbarkedUnitDefense() const;
@@ -1120,6 +1145,12 @@ public:
 	void LogWorkerEvent(BuildTypes eBuildType, bool bStartingConstruction);
 
 	int GetPower() const;
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	void UpdateUnitPowerField(bool bRebuild = false);
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	void UpdateMilitaryMightContribution(bool bRebuild = false);
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 
 	bool AreUnitsOfSameType(const CvUnit& pUnit2, const bool bPretendEmbarked = false) const;
 	bool CanSwapWithUnitHere(CvPlot& pPlot) const;
@@ -1494,6 +1525,19 @@ protected:
 	CvString m_strName;
 	GreatWorkType m_eGreatWork;
 	int m_iTourismBlastStrength;
+#ifdef AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+	mutable CvUnitAuraCombatCache m_kAuraCombatCache; // not serialized
+#endif // AUI_UNIT_CACHE_AURA_COMBAT_MODIFIERS
+#ifdef AUI_MAP_UNIT_POWER_FIELDS
+	// Not serialized, what this unit currently contributes to its owner's unit power field
+	int m_iPowerFieldPlotIndex;
+	int m_iPowerFieldPower;
+	bool m_bPowerFieldGreatGeneral;
+#endif // AUI_MAP_UNIT_POWER_FIELDS
+#ifdef AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
+	// Not serialized, what this unit currently contributes to its owner's running military might total
+	int m_iMilitaryMightContribution;
+#endif // AUI_PLAYER_INCREMENTAL_MILITARY_MIGHT
 
 	mutable CvPathNodeArray m_kLastPath;
 	mutable uint m_uiLastPathCacheDest;
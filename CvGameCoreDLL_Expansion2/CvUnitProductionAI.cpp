@@ -146,6 +146,28 @@ void CvUnitProductionAI::AddFlavorWeights(FlavorTypes eFlavor, int iWeight)
 	}
 }
 
+#ifdef AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+/// Establish weights for all flavors at once (one weight per flavor, indexed by flavor type)
+void CvUnitProductionAI::AddFlavorWeights(const int* paiFlavorWeights)
+{
+	const int iNumFlavors = GC.getNumFlavorTypes();
+
+	for(int iUnit = 0; iUnit < m_pUnits->GetNumUnits(); iUnit++)
+	{
+		CvUnitEntry* entry = m_pUnits->GetEntry(iUnit);
+		if(entry)
+		{
+			int iWeight = 0;
+			for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+			{
+				iWeight += entry->GetFlavorValue(iFlavor) * paiFlavorWeights[iFlavor];
+			}
+			m_UnitAIWeights.IncreaseWeight(iUnit, iWeight);
+		}
+	}
+}
+#endif // AUI_CITYSTRATEGY_BATCHED_FLAVOR_WEIGHTS
+
 /// Retrieve sum of weights on one item
 int CvUnitProductionAI::GetWeight(UnitTypes eUnit)
 {
@@ -7394,6 +7394,10 @@ FDataStream& operator<<(FDataStream& saveTo, const CvGameLeagues& readFrom)
 CvLeagueAI::CvLeagueAI(void)
 {
 	m_pPlayer = NULL;
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	m_bEvaluationSessionActive = false;
+	m_kEvaluationContext.Clear();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 }
 
 CvLeagueAI::~CvLeagueAI(void)
@@ -7418,6 +7422,10 @@ void CvLeagueAI::Uninit()
 void CvLeagueAI::Reset()
 {
 	m_vVoteCommitmentList.clear();
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	m_bEvaluationSessionActive = false;
+	m_kEvaluationContext.Clear();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 }
 
 void CvLeagueAI::Read(FDataStream& kStream)
@@ -8518,6 +8526,9 @@ void CvLeagueAI::AllocateVotes(CvLeague* pLeague)
 	VoteConsiderationList vConsiderations;
 	int iFocusResolutionID = -1;
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	BeginEvaluationSession();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 	EnactProposalList vEnactProposals = pLeague->GetEnactProposals();
 	for (EnactProposalList::iterator it = vEnactProposals.begin(); it != vEnactProposals.end(); ++it)
 	{
@@ -8540,6 +8551,9 @@ void CvLeagueAI::AllocateVotes(CvLeague* pLeague)
 
 		FindBestVoteChoices(it, vConsiderations);
 	}
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	EndEvaluationSession();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 
 	if (vConsiderations.size() > 0)
 	{
@@ -8831,6 +8845,13 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 	// Evaluate as if we are voting Yes to Enact the proposal.  Post-processing below to fit actual situation.
 #ifdef AUI_VOTING_USE_DOUBLES
 	double dScore = 0;
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	// Outside of a proposal or voting session, nothing gathered earlier can be trusted
+	if (!m_bEvaluationSessionActive)
+	{
+		m_kEvaluationContext.Clear();
+	}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 
 	// == Proposer Choice ==
 	ResolutionDecisionTypes eProposerDecision = pProposal->GetProposerDecision()->GetType();
@@ -8863,10 +8884,18 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 
 	// == Grand Strategy ==
 #ifdef AUI_GS_PRIORITY_RATIO
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	CacheContextVictoryRatios();
+	double dDiploVictoryRatio = m_kEvaluationContext.dDiploVictoryRatio;
+	double dConquestVictoryRatio = m_kEvaluationContext.dConquestVictoryRatio;
+	double dCultureVictoryRatio = m_kEvaluationContext.dCultureVictoryRatio;
+	double dScienceVictoryRatio = m_kEvaluationContext.dScienceVictoryRatio;
+#else
 	double dDiploVictoryRatio = GetPlayer()->GetGrandStrategyAI()->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_UNITED_NATIONS"));
 	double dConquestVictoryRatio = GetPlayer()->GetGrandStrategyAI()->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_CONQUEST"));
 	double dCultureVictoryRatio = GetPlayer()->GetGrandStrategyAI()->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_CULTURE"));
 	double dScienceVictoryRatio = GetPlayer()->GetGrandStrategyAI()->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_SPACESHIP"));
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 #else
 	AIGrandStrategyTypes eGrandStrategy = GetPlayer()->GetGrandStrategyAI()->GetActiveGrandStrategy();
 	bool bSeekingDiploVictory = eGrandStrategy == GC.getInfoTypeForString("AIGRANDSTRATEGY_UNITED_NATIONS");
@@ -8885,6 +8914,11 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 
 #ifdef AUI_VOTING_TWEAKED_INTERNATIONAL_PROJECTS
 		// Production might
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextProductionMight();
+		int iOurProductionMight = m_kEvaluationContext.iOurProductionMight;
+		int iHighestProductionMight = m_kEvaluationContext.iHighestProductionMight;
+#else
 		int iOurProductionMight = GetPlayer()->calculateProductionMight();
 		int iHighestProductionMight = iOurProductionMight;
 		for (int i = 0; i < MAX_MAJOR_CIVS; i++)
@@ -8902,6 +8936,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 				}
 			}
 		}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 
 		// acts as a boolean
 		int iIsStrongProduction = 0;
@@ -9087,6 +9122,65 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 	// Embargo City-States
 	if (pProposal->GetEffects()->bEmbargoCityStates)
 	{
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextTradeSummary();
+		const EvaluationContext& kContext = m_kEvaluationContext;
+		const double dCityStateCountModifier = kContext.dCityStateCountModifier;
+
+		// Would we lose active CS trade routes?
+		if (kContext.iCSPartners > 0)
+		{
+#ifdef AUI_FAST_COMP
+			dScore += FASTMAX(-50, kContext.iCSPartners * -15) * dCityStateCountModifier;
+#else
+			dScore += MAX(-50, kContext.iCSPartners * -15) * dCityStateCountModifier;
+#endif // AUI_FAST_COMP
+		}
+		// Make sure the player actually has some trade connections before applying the positive default score
+		else if (kContext.bHasOutgoingTradeConnection)
+		{
+			dScore += 25 * dCityStateCountModifier;
+		}
+
+		// Can we trade with any major civs?
+		if (kContext.iCivDestinations <= 0)
+		{
+			dScore += -50 * dCityStateCountModifier;
+		}
+		else
+		{
+			// Based on estimates, would we still have enough valid trade routes if this passed?
+			int iPossibleRoutesAfter = kContext.iCivDestinations * GetPlayer()->getNumCities();
+			if ((iPossibleRoutesAfter / 3) < (int) GetPlayer()->GetTrade()->GetNumTradeRoutesPossible())
+			{
+				dScore += -40 * dCityStateCountModifier;
+			}
+		}
+
+		// Player Trait making routes to them valuable (Morocco)
+		if (kContext.bHasIncomingTradeRouteYieldTrait)
+		{
+			dScore += -40 * dCityStateCountModifier;
+		}
+
+		// Player Trait gives us extra routes, embargoes are bad for business (Venice)
+		if (kContext.bHasTradeRoutesModifierTrait)
+		{
+			dScore += -20 * dCityStateCountModifier;
+		}
+
+		// Do we have a policy that benefits from CS trade routes?
+		for (uint ui = 0; ui < kContext.adCityStatePolicyScores.size(); ui++)
+		{
+			dScore += kContext.adCityStatePolicyScores[ui];
+		}
+
+		// Can we build any buildings (or do we have any) that increase our CS trade route yield? (eg. Germany's Hanse)
+		if (kContext.bHasCityStateTradeRouteBuilding)
+		{
+			dScore += -40 * dCityStateCountModifier;
+		}
+#else
 		// Trade connections
 		int iCSDestinations = 0;
 		int iCSPartners = 0;
@@ -9292,6 +9386,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			dScore += -20;
 		}
 #endif // AUI_VOTING_TWEAKED_EMBARGO_MINOR_CIVS
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 	}
 	// Embargo
 	if (pProposal->GetEffects()->bEmbargoPlayer)
@@ -9308,10 +9403,19 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 		}
 		else if (!GET_PLAYER(eTargetPlayer).isMinorCiv())
 		{
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+			CvAssertMsg(eTargetPlayer < MAX_MAJOR_CIVS, "Evaluating an embargo on a player that is not a major civ.");
+			CacheContextMajorRelations();
+			ThreatTypes eWarmongerThreat = (ThreatTypes)m_kEvaluationContext.aiWarmongerThreat[eTargetPlayer];
+			MajorCivOpinionTypes eOpinion = (MajorCivOpinionTypes)m_kEvaluationContext.aiOpinion[eTargetPlayer];
+			MajorCivApproachTypes eApproach = (MajorCivApproachTypes)m_kEvaluationContext.aiApproach[eTargetPlayer];
+			if (m_kEvaluationContext.abAtWar[eTargetPlayer])
+#else
 			ThreatTypes eWarmongerThreat = GetPlayer()->GetDiplomacyAI()->GetWarmongerThreat(eTargetPlayer);
 			MajorCivOpinionTypes eOpinion = GetPlayer()->GetDiplomacyAI()->GetMajorCivOpinion(eTargetPlayer);
 			MajorCivApproachTypes eApproach = GetPlayer()->GetDiplomacyAI()->GetMajorCivApproach(eTargetPlayer, /*bHideTrueFeelings*/ true);
 			if (GET_TEAM(GetPlayer()->getTeam()).isAtWar(GET_PLAYER(eTargetPlayer).getTeam()))
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 			{
 				dScore += 70;
 			}
@@ -9367,6 +9471,27 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 #ifndef AUI_VOTING_TWEAKED_BAN_LUXURY
 		bool bOwnedByAnyPlayer = false;
 #endif // AUI_VOTING_TWEAKED_BAN_LUXURY
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextMajorRelations();
+		for (int i = 0; i < MAX_MAJOR_CIVS; i++)
+		{
+			if (m_kEvaluationContext.abMetAndAlive[i] && GET_PLAYER((PlayerTypes)i).getNumResourceTotal(eTargetLuxury) > 0)
+			{
+				if (m_kEvaluationContext.abAtWar[i])
+				{
+					iOtherPlayerResourceFactor += -3;
+				}
+				else if (m_kEvaluationContext.abDoFOrTeammate[i])
+				{
+					iOtherPlayerResourceFactor += 3;
+				}
+				else
+				{
+					iOtherPlayerResourceFactor += m_kEvaluationContext.aiOpinion[i] - MAJOR_CIV_OPINION_NEUTRAL;
+				}
+			}
+		}
+#else
 		for (int i = 0; i < MAX_MAJOR_CIVS; i++)
 		{
 			PlayerTypes e = (PlayerTypes) i;
@@ -9418,9 +9543,44 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 				}
 			}
 		}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 #ifdef AUI_VOTING_TWEAKED_BAN_LUXURY
 		dScore += (iOtherPlayerResourceFactor < 0 ? 1 : -1) * 10.0 * sqrt((double)abs(iOtherPlayerResourceFactor));
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		// Do we have this resource?
+		CacheContextEconomy();
+		if (GetPlayer()->getNumResourceTotal(eTargetLuxury) > 0)
+		{
+			int iHappinessFromResource = GetPlayer()->GetHappinessFromLuxury(eTargetLuxury);
+			// The resource is already banned, so happiness from it needs to be fetched from Infos
+			if (iHappinessFromResource == 0)
+			{
+				CvResourceInfo* pkResourceInfo = GC.getResourceInfo(eTargetLuxury);
+				if (pkResourceInfo)
+				{
+					iHappinessFromResource = pkResourceInfo->getHappiness();
+				}
+			}
+			// Resource bonus from Minors, and this is a Luxury we're getting from one (Policies, etc.)
+			if (m_kEvaluationContext.bMinorResourceBonus && GetPlayer()->getResourceFromMinors(eTargetLuxury) > 0)
+			{
+				iHappinessFromResource *= /*150*/ GC.getMINOR_POLICY_RESOURCE_HAPPINESS_MULTIPLIER();
+				iHappinessFromResource /= 100;
+			}
+			iHappinessFromResource += MAX(m_kEvaluationContext.iHappinessFromResourceVariety - GC.getHAPPINESS_PER_EXTRA_LUXURY(), 0);
+			iHappinessFromResource += m_kEvaluationContext.iExtraHappinessPerLuxury;
+			dScore += -7.5 * iHappinessFromResource;
+			if (m_kEvaluationContext.iExcessHappiness <= iHappinessFromResource)
+			{
+				dScore += -20.0 * pow(2.0, 1.0 - (m_kEvaluationContext.iExcessHappiness - iHappinessFromResource) / 10.0);
+			}			
+		}
+		else if (m_kEvaluationContext.bEmpireUnhappy)
+		{
+			dScore += -10 * pow(2.0, 1.0 - m_kEvaluationContext.iExcessHappiness / 10.0);
+		}
+#else
 		// Do we have this resource?
 		if (GetPlayer()->getNumResourceTotal(eTargetLuxury) > 0)
 		{
@@ -9452,6 +9612,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 		{
 			dScore += -10 * pow(2.0, 1.0 - GetPlayer()->GetExcessHappiness() / 10.0);
 		}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 		if (GetPlayer()->getResourceInOwnedPlots(eTargetLuxury) > 0)
 		{
 			dScore += -20;
@@ -9526,8 +9687,14 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 #endif // AUI_GS_PRIORITY_RATIO
 
 		// What is the ratio of our current maintenance costs to our gross GPT?
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextEconomy();
+		int iUnitMaintenance = m_kEvaluationContext.iUnitMaintenance;
+		int iGPT = m_kEvaluationContext.iGrossGold;
+#else
 		int iUnitMaintenance = GetPlayer()->GetTreasury()->GetExpensePerTurnUnitMaintenance();
 		int iGPT = GetPlayer()->GetTreasury()->CalculateGrossGold();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 		double dRatio = ((double)iUnitMaintenance / (double)iGPT);
 #ifdef AUI_VOTING_TWEAKED_STANDING_ARMY
 		dScore += (-20 - 70.0 * sqrt(dRatio)) * (double)pProposal->GetEffects()->iUnitMaintenanceGoldPercent / 25.0;
@@ -9553,7 +9720,12 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 	// Scholars in Residence
 	if (pProposal->GetEffects()->iMemberDiscoveredTechMod != 0)
 	{
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextEconomy();
+		double dTechRatio = m_kEvaluationContext.dTechRatio;
+#else
 		double dTechRatio = GetPlayer()->GetPlayerTechs()->GetTechAI()->GetTechRatio();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 		dTechRatio = (dTechRatio - 0.5) * 2.0; // -1.0 if in first, 1.0 if in last
 #ifdef AUI_VOTING_TWEAKED_SCHOLARS_IN_RESIDENCE
 		// adjust fTechRatio in case value is not the expected -20% cost
@@ -9884,6 +10056,17 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 
 		// Do we have a sciencey Great Person unique unit? (ie. Merchant of Venice)
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		CacheContextGreatPersonSummary();
+		if (m_kEvaluationContext.bScienceyUniqueUnit)
+		{
+			dScore += 60.0 * dScienceyGreatPersonRateMod;
+		}
+		if (m_kEvaluationContext.bArtsyUniqueUnit)
+		{
+			dScore += 60.0 * dArtsyGreatPersonRateMod;
+		}
+#else
 		bool bScienceyUniqueUnit = false;
 		UnitClassTypes eScienceyUnitClass = (UnitClassTypes) GC.getInfoTypeForString("UNITCLASS_MERCHANT", true);
 		if (eScienceyUnitClass != NO_UNITCLASS)
@@ -9995,6 +10178,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 		{
 			dScore += 60.0 * dArtsyGreatPersonRateMod;
 		}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 
 		// Do we have a trait that alters sciencey Great Person rate?
 		if (GetPlayer()->GetPlayerTraits()->GetGreatScientistRateModifier() != 0)
@@ -10013,6 +10197,23 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			dScore += (iGoldenAgeArtsyTotalBonus > 0 ? 60 : -60) * dArtsyGreatPersonRateMod;
 		}
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+		// Do we have any policies that alter sciency or artsy Great Person rate?
+		CacheContextGreatPersonSummary();
+		for (uint ui = 0; ui < m_kEvaluationContext.adGreatPersonPolicyDividers.size(); ui++)
+		{
+			double dDivider = m_kEvaluationContext.adGreatPersonPolicyDividers[ui];
+			for (int iI = 0; iI < m_kEvaluationContext.aiGreatPersonPolicyScienceyCount[ui]; iI++)
+			{
+				dScore += 60 * dScienceyGreatPersonRateMod / dDivider;
+			}
+			// These are 20 because usually a single policy will modify all 3 at once
+			for (int iI = 0; iI < m_kEvaluationContext.aiGreatPersonPolicyArtsyCount[ui]; iI++)
+			{
+				dScore += 20 * dArtsyGreatPersonRateMod / dDivider;
+			}
+		}
+#else
 		// Do we have any policies that alter sciency or artsy Great Person rate?
 		int iPolicy;
 		CvPolicyEntry* entry;
@@ -10053,6 +10254,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 				}
 			}
 		}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 	}
 #else
 	// Arts Funding
@@ -10177,7 +10379,11 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 	{
 		if (eProposer != NO_PLAYER)
 		{
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+			AlignmentLevels eAlignment = GetContextAlignment(eProposer);
+#else
 			AlignmentLevels eAlignment = EvaluateAlignment(eProposer);
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 			switch (eAlignment)
 			{
 			case ALIGNMENT_SELF:
@@ -11214,6 +11420,9 @@ void CvLeagueAI::AllocateProposals(CvLeague* pLeague)
 	std::vector<ResolutionTypes> vInactive = pLeague->GetInactiveResolutions();
 	ActiveResolutionList vActive = pLeague->GetActiveResolutions();
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	BeginEvaluationSession();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 	if (!vActive.empty())
 	{
 		for (uint iResolutionIndex = 0; iResolutionIndex < vActive.size(); iResolutionIndex++)
@@ -11262,6 +11471,9 @@ void CvLeagueAI::AllocateProposals(CvLeague* pLeague)
 			}
 		}
 	}
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	EndEvaluationSession();
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 
 	// Choose by weight from the top N
 	CvAssertMsg(vConsiderations.size() > 0, "No proposals available for the AI to make. Please send Anton your save file and version.");
@@ -11351,6 +11563,321 @@ int CvLeagueAI::ScoreProposal(CvLeague* pLeague, CvActiveResolution* pResolution
 	return iYesScore;
 }
 
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+void CvLeagueAI::EvaluationContext::Clear()
+{
+	bHaveVictoryRatios = false;
+	bHaveProductionMight = false;
+	bHaveTradeSummary = false;
+	bHaveMajorRelations = false;
+	bHaveEconomy = false;
+	bHaveGreatPersonSummary = false;
+	adCityStatePolicyScores.clear();
+	adGreatPersonPolicyDividers.clear();
+	aiGreatPersonPolicyScienceyCount.clear();
+	aiGreatPersonPolicyArtsyCount.clear();
+	for (int i = 0; i < MAX_CIV_PLAYERS; i++)
+	{
+		aiAlignment[i] = -1;
+	}
+}
+
+// Everything gathered from here until EndEvaluationSession() is shared by all proposals and choices scored in between
+void CvLeagueAI::BeginEvaluationSession()
+{
+	m_kEvaluationContext.Clear();
+	m_bEvaluationSessionActive = true;
+}
+
+void CvLeagueAI::EndEvaluationSession()
+{
+	m_bEvaluationSessionActive = false;
+}
+
+void CvLeagueAI::CacheContextVictoryRatios()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveVictoryRatios)
+		return;
+
+	CvGrandStrategyAI* pGrandStrategyAI = GetPlayer()->GetGrandStrategyAI();
+	kContext.dDiploVictoryRatio = pGrandStrategyAI->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_UNITED_NATIONS"));
+	kContext.dConquestVictoryRatio = pGrandStrategyAI->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_CONQUEST"));
+	kContext.dCultureVictoryRatio = pGrandStrategyAI->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_CULTURE"));
+	kContext.dScienceVictoryRatio = pGrandStrategyAI->GetGrandStrategyPriorityRatio((AIGrandStrategyTypes)GC.getInfoTypeForString("AIGRANDSTRATEGY_SPACESHIP"));
+	kContext.bHaveVictoryRatios = true;
+}
+
+void CvLeagueAI::CacheContextProductionMight()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveProductionMight)
+		return;
+
+	kContext.iOurProductionMight = GetPlayer()->calculateProductionMight();
+	kContext.iHighestProductionMight = kContext.iOurProductionMight;
+	for (int i = 0; i < MAX_MAJOR_CIVS; i++)
+	{
+		PlayerTypes e = (PlayerTypes) i;
+		if (GET_PLAYER(e).isAlive() && !GET_PLAYER(e).isMinorCiv() && !GET_PLAYER(e).isBarbarian())
+		{
+			if (GetPlayer()->GetID() != e)
+			{
+				int iMight = GET_PLAYER(e).calculateProductionMight();
+				if (iMight > kContext.iHighestProductionMight)
+				{
+					kContext.iHighestProductionMight = iMight;
+				}
+			}
+		}
+	}
+	kContext.bHaveProductionMight = true;
+}
+
+void CvLeagueAI::CacheContextTradeSummary()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveTradeSummary)
+		return;
+
+	CacheContextVictoryRatios();
+
+	// Trade connections
+	kContext.iCSDestinations = 0;
+	kContext.iCSPartners = 0;
+	kContext.iCivEmbargos = 0;
+	kContext.iCivDestinations = 0;
+	for (int i = 0; i < MAX_CIV_PLAYERS; i++)
+	{
+		PlayerTypes e = (PlayerTypes) i;
+		if (e != GetPlayer()->GetID() && GET_PLAYER(e).isAlive())
+		{
+			if (GET_PLAYER(e).isMinorCiv())
+			{
+				kContext.iCSDestinations++;
+				if (GC.getGame().GetGameTrade()->IsPlayerConnectedToPlayer(GetPlayer()->GetID(), e))
+				{
+					kContext.iCSPartners++;
+				}
+			}
+			else if (GC.getGame().GetGameLeagues()->IsTradeEmbargoed(GetPlayer()->GetID(), e))
+			{
+				kContext.iCivEmbargos++;
+			}
+			else
+			{
+				kContext.iCivDestinations += GET_PLAYER(e).getNumCities();
+			}
+		}
+	}
+
+	kContext.bHasOutgoingTradeConnection = false;
+	CvGameTrade* pTrade = GC.getGame().GetGameTrade();
+	for (uint ui = 0; ui < pTrade->m_aTradeConnections.size(); ui++)
+	{
+		if (pTrade->m_aTradeConnections[ui].m_eOriginOwner == m_pPlayer->GetID())
+		{
+			kContext.bHasOutgoingTradeConnection = true;
+			break;
+		}
+	}
+
+	kContext.bHasIncomingTradeRouteYieldTrait = false;
+	for (int i = 0; i < NUM_YIELD_TYPES; i++)
+	{
+		if (GetPlayer()->GetPlayerTraits()->GetYieldChangeIncomingTradeRoute((YieldTypes)i) > 0)
+		{
+			kContext.bHasIncomingTradeRouteYieldTrait = true;
+			break;
+		}
+	}
+	kContext.bHasTradeRoutesModifierTrait = GetPlayer()->GetPlayerTraits()->GetNumTradeRoutesModifier() > 0;
+
+	// Adjusts score change based on how many city states there are
+	kContext.dCityStateCountModifier = 1.0;
+#ifdef AUI_MINOR_CIV_RATIO
+	const double dCityStateDeviation = 1.0 + log(GC.getGame().getCurrentMinorCivDeviation());
+	// Calculation is more complex than for Policies or Beliefs because we only ever want it to be 0 when there are no city states.
+	if (dCityStateDeviation >= exp(-1.0))
+	{
+		kContext.dCityStateCountModifier = dCityStateDeviation;
+	}
+	else
+	{
+		kContext.dCityStateCountModifier = exp(dCityStateDeviation);
+	}
+#endif // AUI_MINOR_CIV_RATIO
+
+	// Score contributions of policies that benefit from CS trade routes, in policy order
+	kContext.adCityStatePolicyScores.clear();
+	CvPlayerPolicies* pPlayerPolicies = GetPlayer()->GetPlayerPolicies();
+	for (int iPolicy = 0; iPolicy < pPlayerPolicies->GetPolicies()->GetNumPolicies(); iPolicy++)
+	{
+		CvPolicyEntry* entry = pPlayerPolicies->GetPolicies()->GetPolicyEntry(iPolicy);
+		if ((entry) && (pPlayerPolicies->HasPolicy(static_cast<PolicyTypes>(iPolicy))
+			|| pPlayerPolicies->IsPolicyBranchUnlocked(static_cast<PolicyBranchTypes>(entry->GetPolicyBranchType()))))
+		{
+			// If the player doesn't have the policy, but has the policy's branch unlocked, score should still be adjusted, but by a much smaller amount
+			int iDivider = pPlayerPolicies->HasPolicy(static_cast<PolicyTypes>(iPolicy)) ? 1 : 2;
+			if (entry->GetProtectedMinorPerTurnInfluence() > 0)
+			{
+				kContext.adCityStatePolicyScores.push_back((-20 - 40 * kContext.dDiploVictoryRatio) * kContext.dCityStateCountModifier / (double)iDivider);
+			}
+			if (entry->GetCityStateTradeChange() > 0)
+			{
+				kContext.adCityStatePolicyScores.push_back(-40 * kContext.dCityStateCountModifier / (double)iDivider);
+			}
+		}
+	}
+
+	// Can we build any buildings (or do we have any) that increase our CS trade route yield? (eg. Germany's Hanse)
+	kContext.bHasCityStateTradeRouteBuilding = false;
+	for (int iI = 0; iI < GC.getNumBuildingClassInfos() && !kContext.bHasCityStateTradeRouteBuilding; iI++)
+	{
+		BuildingTypes eBuilding = (BuildingTypes)m_pPlayer->getCivilizationInfo().getCivilizationBuildings(iI);
+		if (eBuilding != NO_BUILDING)
+		{
+			CvBuildingEntry* pBuildingEntry = GC.GetGameBuildings()->GetEntry(eBuilding);
+			if (pBuildingEntry && pBuildingEntry->GetCityStateTradeRouteProductionModifier() > 0)
+			{
+				int iLoop;
+				CvCity* pLoopCity;
+				for (pLoopCity = m_pPlayer->firstCity(&iLoop); pLoopCity != NULL; pLoopCity = m_pPlayer->nextCity(&iLoop))
+				{
+					if (pLoopCity->canConstruct(eBuilding, false, false, true) || (pLoopCity->GetCityBuildings()->GetNumBuilding(eBuilding) > 0))
+					{
+						kContext.bHasCityStateTradeRouteBuilding = true;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	kContext.bHaveTradeSummary = true;
+}
+
+void CvLeagueAI::CacheContextMajorRelations()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveMajorRelations)
+		return;
+
+	CvDiplomacyAI* pDiplomacyAI = GetPlayer()->GetDiplomacyAI();
+	CvTeam& kOurTeam = GET_TEAM(GetPlayer()->getTeam());
+	for (int i = 0; i < MAX_MAJOR_CIVS; i++)
+	{
+		PlayerTypes e = (PlayerTypes) i;
+		CvPlayer& kPlayer = GET_PLAYER(e);
+		kContext.abMetAndAlive[i] = (e != GetPlayer()->GetID() && kPlayer.isAlive() && !kPlayer.isMinorCiv() && kOurTeam.isHasMet(kPlayer.getTeam()));
+		if (e == GetPlayer()->GetID())
+		{
+			kContext.abAtWar[i] = false;
+			kContext.abDoFOrTeammate[i] = true;
+			kContext.aiWarmongerThreat[i] = THREAT_NONE;
+			kContext.aiOpinion[i] = MAJOR_CIV_OPINION_NEUTRAL;
+			kContext.aiApproach[i] = MAJOR_CIV_APPROACH_NEUTRAL;
+			continue;
+		}
+		kContext.abAtWar[i] = kOurTeam.isAtWar(kPlayer.getTeam());
+		kContext.abDoFOrTeammate[i] = pDiplomacyAI->IsDoFAccepted(e) || GetPlayer()->getTeam() == kPlayer.getTeam();
+		kContext.aiWarmongerThreat[i] = pDiplomacyAI->GetWarmongerThreat(e);
+		kContext.aiOpinion[i] = pDiplomacyAI->GetMajorCivOpinion(e);
+		kContext.aiApproach[i] = pDiplomacyAI->GetMajorCivApproach(e, /*bHideTrueFeelings*/ true);
+	}
+	kContext.bHaveMajorRelations = true;
+}
+
+void CvLeagueAI::CacheContextEconomy()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveEconomy)
+		return;
+
+	kContext.iExcessHappiness = GetPlayer()->GetExcessHappiness();
+	kContext.bEmpireUnhappy = GetPlayer()->IsEmpireUnhappy();
+	kContext.iHappinessFromResourceVariety = GetPlayer()->GetHappinessFromResourceVariety();
+	kContext.iExtraHappinessPerLuxury = GetPlayer()->GetExtraHappinessPerLuxury();
+	kContext.bMinorResourceBonus = GetPlayer()->IsMinorResourceBonus();
+	kContext.iUnitMaintenance = GetPlayer()->GetTreasury()->GetExpensePerTurnUnitMaintenance();
+	kContext.iGrossGold = GetPlayer()->GetTreasury()->CalculateGrossGold();
+	kContext.dTechRatio = GetPlayer()->GetPlayerTechs()->GetTechAI()->GetTechRatio();
+	kContext.bHaveEconomy = true;
+}
+
+void CvLeagueAI::CacheContextGreatPersonSummary()
+{
+	EvaluationContext& kContext = m_kEvaluationContext;
+	if (kContext.bHaveGreatPersonSummary)
+		return;
+
+	// Do we have a sciencey or artsy Great Person unique unit? (ie. Merchant of Venice)
+	const char* aszScienceyUnitClasses[] = { "UNITCLASS_MERCHANT", "UNITCLASS_SCIENTIST", "UNITCLASS_ENGINEER" };
+	const char* aszArtsyUnitClasses[] = { "UNITCLASS_ARTIST", "UNITCLASS_MUSICIAN", "UNITCLASS_WRITER" };
+	kContext.bScienceyUniqueUnit = false;
+	kContext.bArtsyUniqueUnit = false;
+	for (int iI = 0; iI < 6; iI++)
+	{
+		bool& bUniqueUnit = (iI < 3 ? kContext.bScienceyUniqueUnit : kContext.bArtsyUniqueUnit);
+		if (bUniqueUnit)
+			continue;
+
+		UnitClassTypes eUnitClass = (UnitClassTypes)GC.getInfoTypeForString(iI < 3 ? aszScienceyUnitClasses[iI] : aszArtsyUnitClasses[iI - 3], true);
+		if (eUnitClass != NO_UNITCLASS)
+		{
+			CvUnitClassInfo* pUnitClassInfo = GC.getUnitClassInfo(eUnitClass);
+			if (pUnitClassInfo)
+			{
+				UnitTypes eUnit = (UnitTypes)GetPlayer()->getCivilizationInfo().getCivilizationUnits(eUnitClass);
+				UnitTypes eDefault = (UnitTypes)pUnitClassInfo->getDefaultUnitIndex();
+				if (eUnit != eDefault)
+				{
+					bUniqueUnit = true;
+				}
+			}
+		}
+	}
+
+	// Policies that alter sciency or artsy Great Person rate, in policy order
+	kContext.adGreatPersonPolicyDividers.clear();
+	kContext.aiGreatPersonPolicyScienceyCount.clear();
+	kContext.aiGreatPersonPolicyArtsyCount.clear();
+	CvPlayerPolicies* pPlayerPolicies = GetPlayer()->GetPlayerPolicies();
+	for (int iPolicy = 0; iPolicy < pPlayerPolicies->GetPolicies()->GetNumPolicies(); iPolicy++)
+	{
+		CvPolicyEntry* entry = pPlayerPolicies->GetPolicies()->GetPolicyEntry(iPolicy);
+		if ((entry) && (pPlayerPolicies->HasPolicy(static_cast<PolicyTypes>(iPolicy))
+			|| pPlayerPolicies->IsPolicyBranchUnlocked(static_cast<PolicyBranchTypes>(entry->GetPolicyBranchType()))))
+		{
+			int iSciencey = (entry->GetGreatMerchantRateModifier() > 0 ? 1 : 0) + (entry->GetGreatScientistRateModifier() > 0 ? 1 : 0);
+			int iArtsy = (entry->GetGreatArtistRateModifier() > 0 ? 1 : 0) + (entry->GetGreatMusicianRateModifier() > 0 ? 1 : 0) + (entry->GetGreatWriterRateModifier() > 0 ? 1 : 0);
+			if (iSciencey > 0 || iArtsy > 0)
+			{
+				// If the player doesn't have the policy, but has the policy's branch unlocked, score should still be adjusted, but by a much smaller amount
+				kContext.adGreatPersonPolicyDividers.push_back(pPlayerPolicies->HasPolicy(static_cast<PolicyTypes>(iPolicy)) ? 1.0 : 3.0);
+				kContext.aiGreatPersonPolicyScienceyCount.push_back(iSciencey);
+				kContext.aiGreatPersonPolicyArtsyCount.push_back(iArtsy);
+			}
+		}
+	}
+
+	kContext.bHaveGreatPersonSummary = true;
+}
+
+CvLeagueAI::AlignmentLevels CvLeagueAI::GetContextAlignment(PlayerTypes ePlayer)
+{
+	if (ePlayer < 0 || ePlayer >= MAX_CIV_PLAYERS)
+	{
+		return EvaluateAlignment(ePlayer);
+	}
+	if (m_kEvaluationContext.aiAlignment[ePlayer] < 0)
+	{
+		m_kEvaluationContext.aiAlignment[ePlayer] = (int)EvaluateAlignment(ePlayer);
+	}
+	return (AlignmentLevels)m_kEvaluationContext.aiAlignment[ePlayer];
+}
+#endif // AUI_VOTING_EVALUATION_CONTEXT
+
 void CvLeagueAI::LogVoteChoiceConsidered(CvEnactProposal* pProposal, int iChoice, int iScore)
 {
 	CvAssert(pProposal != NULL);
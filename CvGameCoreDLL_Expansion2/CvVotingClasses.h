@@ -905,6 +905,75 @@ private:
 	void LogVoteChoiceConsidered(CvRepealProposal* pProposal, int iChoice, int iScore);
 	void LogVoteChoiceCommitted(CvEnactProposal* pProposal, int iChoice, int iVotes);
 	void LogVoteChoiceCommitted(CvRepealProposal* pProposal, int iChoice, int iVotes);
+
+#ifdef AUI_VOTING_EVALUATION_CONTEXT
+	// Player-wide inputs to proposal scoring that stay fixed for the duration of one proposal or voting session; each group is filled on first use
+	struct EvaluationContext
+	{
+		void Clear();
+
+		bool bHaveVictoryRatios;
+		double dDiploVictoryRatio;
+		double dConquestVictoryRatio;
+		double dCultureVictoryRatio;
+		double dScienceVictoryRatio;
+
+		bool bHaveProductionMight;
+		int iOurProductionMight;
+		int iHighestProductionMight;
+
+		bool bHaveTradeSummary;
+		int iCSDestinations;
+		int iCSPartners;
+		int iCivEmbargos;
+		int iCivDestinations;
+		bool bHasOutgoingTradeConnection;
+		bool bHasIncomingTradeRouteYieldTrait;
+		bool bHasTradeRoutesModifierTrait;
+		double dCityStateCountModifier;
+		std::vector<double> adCityStatePolicyScores;
+		bool bHasCityStateTradeRouteBuilding;
+
+		bool bHaveMajorRelations;
+		bool abMetAndAlive[MAX_MAJOR_CIVS];
+		bool abAtWar[MAX_MAJOR_CIVS];
+		bool abDoFOrTeammate[MAX_MAJOR_CIVS];
+		int aiWarmongerThreat[MAX_MAJOR_CIVS];
+		int aiOpinion[MAX_MAJOR_CIVS];
+		int aiApproach[MAX_MAJOR_CIVS];
+		int aiAlignment[MAX_CIV_PLAYERS];
+
+		bool bHaveEconomy;
+		int iExcessHappiness;
+		bool bEmpireUnhappy;
+		int iHappinessFromResourceVariety;
+		int iExtraHappinessPerLuxury;
+		bool bMinorResourceBonus;
+		int iUnitMaintenance;
+		int iGrossGold;
+		double dTechRatio;
+
+		bool bHaveGreatPersonSummary;
+		bool bScienceyUniqueUnit;
+		bool bArtsyUniqueUnit;
+		std::vector<double> adGreatPersonPolicyDividers;
+		std::vector<int> aiGreatPersonPolicyScienceyCount;
+		std::vector<int> aiGreatPersonPolicyArtsyCount;
+	};
+
+	void BeginEvaluationSession();
+	void EndEvaluationSession();
+	void CacheContextVictoryRatios();
+	void CacheContextProductionMight();
+	void CacheContextTradeSummary();
+	void CacheContextMajorRelations();
+	void CacheContextEconomy();
+	void CacheContextGreatPersonSummary();
+	AlignmentLevels GetContextAlignment(PlayerTypes ePlayer);
+
+	EvaluationContext m_kEvaluationContext;
+	bool m_bEvaluationSessionActive;
+#endif // AUI_VOTING_EVALUATION_CONTEXT
 };
 
 
@@ -161,12 +161,22 @@ void CvWonderProductionAI::Write(FDataStream& kStream) const
 /// Respond to a new set of flavor values
 void CvWonderProductionAI::FlavorUpdate()
 {
+#ifdef AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
+	const int iNumFlavors = GC.getNumFlavorTypes();
+	int* paiFlavorWeights = (int*)_alloca(sizeof(int) * iNumFlavors);
+	for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+	{
+		paiFlavorWeights[iFlavor] = GetLatestFlavorValue((FlavorTypes)iFlavor);
+	}
+	AddFlavorWeights(paiFlavorWeights);
+#else
 	// Broadcast to our sub AI objects
 	for(int iFlavor = 0; iFlavor < GC.getNumFlavorTypes(); iFlavor++)
 	{
 		int iFlavorValue = GetLatestFlavorValue((FlavorTypes)iFlavor);
 		AddFlavorWeights((FlavorTypes)iFlavor, iFlavorValue);
 	}
+#endif // AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
 }
 
 /// Establish weights for one flavor; can be called multiple times to layer strategies
@@ -188,6 +198,33 @@ void CvWonderProductionAI::AddFlavorWeights(FlavorTypes eFlavor, int iWeight)
 	}
 }
 
+#ifdef AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
+/// Establish weights for all flavors at once (one weight per flavor, indexed by flavor type)
+void CvWonderProductionAI::AddFlavorWeights(const int* paiFlavorWeights)
+{
+	const int iNumFlavors = GC.getNumFlavorTypes();
+
+	// Loop through all buildings (even though we're only go to do anything on wonders)
+	for(int iBldg = 0; iBldg < m_pBuildings->GetNumBuildings(); iBldg++)
+	{
+		CvBuildingEntry* entry = m_pBuildings->GetEntry(iBldg);
+		if(entry)
+		{
+			CvBuildingEntry& kBuilding = *entry;
+			if(IsWonder(kBuilding))
+			{
+				int iWeight = 0;
+				for(int iFlavor = 0; iFlavor < iNumFlavors; iFlavor++)
+				{
+					iWeight += kBuilding.GetFlavorValue(iFlavor) * paiFlavorWeights[iFlavor];
+				}
+				m_WonderAIWeights.IncreaseWeight(iBldg, iWeight);
+			}
+		}
+	}
+}
+#endif // AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
+
 /// Retrieve sum of weights on one item
 int CvWonderProductionAI::GetWeight(BuildingTypes eBldg)
 {
@@ -42,6 +42,9 @@ public:
 
 	// Establish/retrieve weights for one flavor
 	void AddFlavorWeights(FlavorTypes eFlavor, int iWeight);
+#ifdef AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
+	void AddFlavorWeights(const int* paiFlavorWeights);
+#endif // AUI_WONDER_PRODUCTION_BATCHED_FLAVOR_WEIGHTS
 	int GetWeight(BuildingTypes eBuilding);
 
 	// Recommend highest-weighted wonder
@@ -7336,11 +7336,19 @@ int CvLuaPlayer::lGetReplayData(lua_State* L)
 	{
 		lua_pushstring(L, pkPlayer->getReplayDataSetName(uiDataSet));
 
+#ifdef AUI_PLAYER_INTERNED_REPLAY_DATASETS
+		const CvPlayer::TurnData& data = pkPlayer->getReplayDataHistory(uiDataSet);
+
+		lua_createtable(L, data.size() - 1, 1);
+
+		for(CvPlayer::TurnData::const_iterator it = data.begin(); it != data.end(); ++it)
+#else
 		CvPlayer::TurnData data = pkPlayer->getReplayDataHistory(uiDataSet);
 
 		lua_createtable(L, data.size() - 1, 1);
 
 		for(CvPlayer::TurnData::iterator it = data.begin(); it != data.end(); ++it)
+#endif // AUI_PLAYER_INTERNED_REPLAY_DATASETS
 		{
 			lua_pushinteger(L, (*it).second);
 			lua_rawseti(L, -2, (*it).first);